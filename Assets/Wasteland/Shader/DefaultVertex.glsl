@@ -5,9 +5,19 @@ layout (location = 1) in vec3 colorIn;
 layout (location = 2) in vec3 normalIn;
 layout (location = 3) in vec2 uvsIn;
 
-uniform mat4 projection;
-uniform mat4 view;
-uniform mat4 model;
+layout (std140) uniform FrameData
+{
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	vec3 cameraPosition;
+	float time;
+};
+
+layout (std140) uniform ObjectData
+{
+	mat4 model;
+};
 
 out vec3 color;
 out vec3 normal;
@@ -15,7 +25,7 @@ out vec2 uvs;
 
 void main()
 {
-	gl_Position = projection * view * model * vec4(positionIn, 1.0);
+	gl_Position = viewProjection * model * vec4(positionIn, 1.0);
 
 	color = colorIn;
 	normal = normalIn;
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "Math/BatchMath.hpp"
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+using namespace Wasteland::Math;
+
+namespace Wasteland::Benchmark
+{
+	class BatchMathBenchmark final
+	{
+
+	public:
+
+		BatchMathBenchmark(const BatchMathBenchmark&) = delete;
+		BatchMathBenchmark(BatchMathBenchmark&&) = delete;
+		BatchMathBenchmark& operator=(const BatchMathBenchmark&) = delete;
+		BatchMathBenchmark& operator=(BatchMathBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("Batch math kernels vs per-element operators");
+			Benchmark::Print("backend {}, {} elements", BatchMath::GetBackendName(), COUNT);
+
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> distribution(-8.0f, 8.0f);
+
+			Matrix<float, 4, 4> matrix = Matrix<float, 4, 4>::TranslationRotationScale({ 1.0f, -2.0f, 3.5f }, { 0.18257419f, 0.36514837f, 0.54772256f, 0.73029674f }, { 2.0f, 0.5f, 1.5f });
+
+			std::vector<float> xs(COUNT), ys(COUNT), zs(COUNT);
+			std::vector<float> outputXs(COUNT), outputYs(COUNT), outputZs(COUNT);
+
+			std::vector<Vector<float, 3>> points(COUNT);
+			std::vector<Vector<float, 3>> outputPoints(COUNT);
+
+			std::vector<Matrix<float, 4, 4>> first(COUNT), second(COUNT), products(COUNT);
+
+			for (size_t i = 0; i < COUNT; ++i)
+			{
+				points[i] = { distribution(random), distribution(random), distribution(random) };
+
+				xs[i] = points[i].x();
+				ys[i] = points[i].y();
+				zs[i] = points[i].z();
+
+				first[i] = Matrix<float, 4, 4>::RotationY(distribution(random)) * Matrix<float, 4, 4>::Translation(points[i]);
+				second[i] = Matrix<float, 4, 4>::Scale({ 1.5f, 2.0f, 0.5f }) * Matrix<float, 4, 4>::RotationX(distribution(random));
+			}
+
+			Bounds bounds;
+
+			double batchTransform = Measure([&]() { BatchMath::TransformPoints(matrix, xs, ys, zs, outputXs, outputYs, outputZs); });
+			double elementTransform = Measure([&]()
+			{
+				for (size_t i = 0; i < COUNT; ++i)
+					outputPoints[i] = matrix.TransformPoint(points[i]);
+			});
+
+			double batchBounds = Measure([&]() { bounds = BatchMath::ComputeBounds(xs, ys, zs); });
+			double elementBounds = Measure([&]()
+			{
+				Vector<float, 3> minimum = points[0];
+				Vector<float, 3> maximum = points[0];
+
+				for (const Vector<float, 3>& point : points)
+				{
+					minimum = { std::min(minimum.x(), point.x()), std::min(minimum.y(), point.y()), std::min(minimum.z(), point.z()) };
+					maximum = { std::max(maximum.x(), point.x()), std::max(maximum.y(), point.y()), std::max(maximum.z(), point.z()) };
+				}
+
+				bounds = { minimum, maximum };
+			});
+
+			double batchMultiply = Measure([&]() { BatchMath::MultiplyMatrices(first, second, products); });
+			double elementMultiply = Measure([&]()
+			{
+				for (size_t i = 0; i < COUNT; ++i)
+					products[i] = first[i] * second[i];
+			});
+
+			double batchNormalize = Measure([&]() { BatchMath::NormalizeMany(outputXs, outputYs, outputZs); });
+			double elementNormalize = Measure([&]()
+			{
+				for (Vector<float, 3>& point : outputPoints)
+					point = Vector<float, 3>::Normalize(point);
+			});
+
+			Report("transform points", batchTransform, elementTransform);
+			Report("compute bounds", batchBounds, elementBounds);
+			Report("multiply matrices", batchMultiply, elementMultiply);
+			Report("normalize", batchNormalize, elementNormalize);
+
+			Benchmark::DoNotOptimize(outputXs);
+			Benchmark::DoNotOptimize(outputPoints);
+			Benchmark::DoNotOptimize(products);
+			Benchmark::DoNotOptimize(bounds);
+		}
+
+	private:
+
+		static constexpr size_t COUNT = 4096;
+		static constexpr size_t REPETITIONS = 100;
+
+		BatchMathBenchmark() = default;
+
+		template <typename F>
+		static double Measure(F&& operation)
+		{
+			return Benchmark::MeasureBestNanoseconds(REPETITIONS, operation) / COUNT;
+		}
+
+		static void Report(const char* name, double batch, double element)
+		{
+			Benchmark::Print("{:<18} batch {:6.2f} ns, per-element {:6.2f} ns ({:.2f}x)", name, batch, element, element / batch);
+		}
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+namespace Wasteland::Benchmark
+{
+	class Benchmark final
+	{
+
+	public:
+
+		using Clock = std::chrono::steady_clock;
+
+		Benchmark(const Benchmark&) = delete;
+		Benchmark(Benchmark&&) = delete;
+		Benchmark& operator=(const Benchmark&) = delete;
+		Benchmark& operator=(Benchmark&&) = delete;
+
+		template <typename F>
+		static double MeasureNanoseconds(F&& function)
+		{
+			Clock::time_point start = Clock::now();
+
+			function();
+
+			return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+		}
+
+		template <typename F>
+		static double MeasureBestNanoseconds(size_t repetitions, F&& function)
+		{
+			double best = MeasureNanoseconds(function);
+
+			for (size_t i = 1; i < repetitions; ++i)
+				best = std::min(best, MeasureNanoseconds(function));
+
+			return best;
+		}
+
+		static double GetPercentile(std::vector<double> samples, double percentile)
+		{
+			if (samples.empty())
+				return 0.0;
+
+			size_t index = std::min(static_cast<size_t>(percentile * samples.size()), samples.size() - 1);
+
+			std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+
+			return samples[index];
+		}
+
+		static std::vector<size_t> GetThreadCounts()
+		{
+			std::vector<size_t> counts = { 1, 3, std::max<size_t>(std::thread::hardware_concurrency(), 1) };
+
+			std::sort(counts.begin(), counts.end());
+			counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+
+			return counts;
+		}
+
+		static void PrintHeader(std::string_view name)
+		{
+			std::cout << std::format("== {} ({} hardware threads)", name, std::thread::hardware_concurrency()) << std::endl;
+		}
+
+		template <typename... Args>
+		static void Print(std::format_string<Args...> format, Args&&... arguments)
+		{
+			std::cout << "   " << std::format(format, std::forward<Args>(arguments)...) << std::endl;
+		}
+
+		template <typename T>
+		static void DoNotOptimize(const T& value)
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			sink = &value;
+			_ReadWriteBarrier();
+#else
+			asm volatile("" : : "r,m"(value) : "memory");
+#endif
+		}
+
+	private:
+
+		Benchmark() = default;
+
+		static const volatile void* sink;
+
+	};
+
+	const volatile void* Benchmark::sink = nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <memory>
+#include <random>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "ECS/GameObjectManager.hpp"
+#include "ECS/View.hpp"
+
+using namespace Wasteland::ECS;
+using namespace Wasteland::Math;
+
+namespace Wasteland::Benchmark
+{
+	class VelocityComponent final : public Component, public Pooled<VelocityComponent>
+	{
+
+	public:
+
+		Vector<float, 3> position = { 0.0f, 0.0f, 0.0f };
+		Vector<float, 3> velocity = { 1.0f, 0.5f, 0.25f };
+
+		static std::shared_ptr<VelocityComponent> Create()
+		{
+			return MakePooledShared(new VelocityComponent());
+		}
+
+	private:
+
+		VelocityComponent() = default;
+
+	};
+
+	class ComponentIterationBenchmark final
+	{
+
+	public:
+
+		ComponentIterationBenchmark(const ComponentIterationBenchmark&) = delete;
+		ComponentIterationBenchmark(ComponentIterationBenchmark&&) = delete;
+		ComponentIterationBenchmark& operator=(const ComponentIterationBenchmark&) = delete;
+		ComponentIterationBenchmark& operator=(ComponentIterationBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("Component iteration, 100k entities after 50% churn");
+
+			std::vector<std::shared_ptr<GameObject>> objects;
+
+			objects.reserve(ENTITY_COUNT);
+
+			for (size_t i = 0; i < ENTITY_COUNT; ++i)
+				objects.push_back(CreateObject());
+
+			GameObjectManager::GetInstance().Update();
+
+			std::mt19937 random(42);
+
+			std::shuffle(objects.begin(), objects.end(), random);
+
+			for (size_t i = 0; i < ENTITY_COUNT / 2; ++i)
+				GameObjectManager::GetInstance().Unregister(objects[i]->GetHandle());
+
+			GameObjectManager::GetInstance().Update();
+
+			for (size_t i = 0; i < ENTITY_COUNT / 2; ++i)
+				objects[i] = CreateObject();
+
+			GameObjectManager::GetInstance().Update();
+
+			double perObject = Measure([&objects]()
+			{
+				for (const auto& object : objects)
+					Integrate(*object->GetComponent<VelocityComponent>().value());
+			});
+
+			double unsorted = Measure([]() { View<VelocityComponent>().ForEach(&Integrate); });
+
+			ComponentStorageBase::SortAll();
+
+			double sorted = Measure([]() { View<VelocityComponent>().ForEach(&Integrate); });
+
+			double joined = Measure([]()
+			{
+				View<VelocityComponent, Transform>().ForEach([](VelocityComponent& component, Transform& transform)
+				{
+					Integrate(component);
+					Benchmark::DoNotOptimize(transform);
+				});
+			});
+
+			Benchmark::Print("per-object GetComponent   {:6.2f} ns/entity", perObject);
+			Benchmark::Print("View, insertion order     {:6.2f} ns/entity", unsorted);
+			Benchmark::Print("View, slot order          {:6.2f} ns/entity", sorted);
+			Benchmark::Print("View with Transform join  {:6.2f} ns/entity", joined);
+
+			for (const auto& object : objects)
+				GameObjectManager::GetInstance().Unregister(object->GetHandle());
+
+			objects.clear();
+
+			GameObjectManager::GetInstance().Update();
+		}
+
+	private:
+
+		static constexpr size_t ENTITY_COUNT = 100000;
+		static constexpr size_t REPETITIONS = 20;
+
+		ComponentIterationBenchmark() = default;
+
+		static std::shared_ptr<GameObject> CreateObject()
+		{
+			auto gameObject = GameObject::Create();
+
+			gameObject->AddComponent(VelocityComponent::Create());
+
+			return GameObjectManager::GetInstance().Register(gameObject);
+		}
+
+		static void Integrate(VelocityComponent& component)
+		{
+			component.position += component.velocity * 0.016f;
+
+			Benchmark::DoNotOptimize(component.position);
+		}
+
+		template <typename F>
+		static double Measure(F&& function)
+		{
+			return Benchmark::MeasureBestNanoseconds(REPETITIONS, function) / ENTITY_COUNT;
+		}
+
+	};
+}
\ No newline at end of file
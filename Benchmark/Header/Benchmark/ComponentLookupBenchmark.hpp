@@ -0,0 +1,155 @@
+#pragma once
+
+#include <format>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "ECS/GameObjectManager.hpp"
+
+using namespace Wasteland::ECS;
+using namespace Wasteland::Math;
+
+namespace Wasteland::Benchmark
+{
+	class LookupBaseComponent : public Component
+	{
+
+	public:
+
+		using LookupBase = LookupBaseComponent;
+
+	};
+
+	class LookupDerivedComponent final : public LookupBaseComponent { };
+
+	class LookupFillerComponentA final : public Component { };
+
+	class LookupFillerComponentB final : public Component { };
+
+	class LookupMissingComponent final : public Component { };
+
+	class LegacyComponentMap final
+	{
+
+	public:
+
+		template <typename T>
+		void Add(std::shared_ptr<T> component)
+		{
+			componentMap.insert({ typeid(T), std::move(component) });
+		}
+
+		template <typename T>
+		std::optional<std::shared_ptr<T>> GetComponent()
+		{
+			if (componentMap.contains(typeid(T)))
+			{
+				auto found = std::static_pointer_cast<T>(componentMap[typeid(T)]);
+				return std::make_optional(found);
+			}
+
+			for (auto& [type, component] : componentMap)
+			{
+				if (auto casted = std::dynamic_pointer_cast<T>(component))
+					return std::make_optional(casted);
+			}
+
+			return std::nullopt;
+		}
+
+		template <typename T>
+		bool HasComponent() const
+		{
+			return componentMap.contains(typeid(T));
+		}
+
+	private:
+
+		std::unordered_map<std::type_index, std::shared_ptr<Component>> componentMap;
+
+	};
+
+	class ComponentLookupBenchmark final
+	{
+
+	public:
+
+		ComponentLookupBenchmark(const ComponentLookupBenchmark&) = delete;
+		ComponentLookupBenchmark(ComponentLookupBenchmark&&) = delete;
+		ComponentLookupBenchmark& operator=(const ComponentLookupBenchmark&) = delete;
+		ComponentLookupBenchmark& operator=(ComponentLookupBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("Component and name lookup");
+
+			auto gameObject = GameObject::Create("benchmark.lookup");
+
+			LegacyComponentMap legacy;
+
+			legacy.Add(gameObject->GetTransform());
+			legacy.Add(gameObject->AddComponent(std::make_shared<LookupFillerComponentA>()));
+			legacy.Add(gameObject->AddComponent(std::make_shared<LookupFillerComponentB>()));
+			legacy.Add(gameObject->AddComponent(std::make_shared<LookupDerivedComponent>()));
+
+			Benchmark::Print("exact type    legacy {:6.2f} ns, table {:6.2f} ns", Measure([&]() { return legacy.GetComponent<Transform>().has_value(); }), Measure([&]() { return gameObject->GetComponent<Transform>().has_value(); }));
+			Benchmark::Print("base class    legacy {:6.2f} ns, table {:6.2f} ns", Measure([&]() { return legacy.GetComponent<LookupBaseComponent>().has_value(); }), Measure([&]() { return gameObject->GetComponent<LookupBaseComponent>().has_value(); }));
+			Benchmark::Print("missing type  legacy {:6.2f} ns, table {:6.2f} ns", Measure([&]() { return legacy.GetComponent<LookupMissingComponent>().has_value(); }), Measure([&]() { return gameObject->GetComponent<LookupMissingComponent>().has_value(); }));
+			Benchmark::Print("has component legacy {:6.2f} ns, table {:6.2f} ns", Measure([&]() { return legacy.HasComponent<LookupFillerComponentB>(); }), Measure([&]() { return gameObject->HasComponent<LookupFillerComponentB>(); }));
+
+			std::unordered_map<std::string, std::shared_ptr<GameObject>> legacyNames;
+			std::vector<std::string> names;
+
+			for (size_t i = 0; i < NAMED_OBJECT_COUNT; ++i)
+			{
+				names.push_back(std::format("benchmark.named.{}", i));
+
+				auto named = GameObject::Create(names.back());
+
+				legacyNames.insert({ names.back(), named });
+				GameObjectManager::GetInstance().Register(named);
+			}
+
+			GameObjectManager::GetInstance().Update();
+
+			size_t next = 0;
+
+			double legacyFind = Measure([&]()
+			{
+				auto iterator = legacyNames.find(names[next++ % names.size()]);
+
+				return iterator == legacyNames.end() ? std::nullopt : std::make_optional(iterator->second);
+			});
+			double find = Measure([&]() { return GameObjectManager::GetInstance().Find(names[next++ % names.size()]); });
+
+			Benchmark::Print("find by name  legacy {:6.2f} ns, name index {:6.2f} ns ({} objects)", legacyFind, find, NAMED_OBJECT_COUNT);
+
+			for (const auto& [name, named] : legacyNames)
+				GameObjectManager::GetInstance().Unregister(named->GetHandle());
+
+			GameObjectManager::GetInstance().Update();
+		}
+
+	private:
+
+		static constexpr size_t LOOKUP_COUNT = 1000000;
+		static constexpr size_t NAMED_OBJECT_COUNT = 10000;
+		static constexpr size_t REPETITIONS = 5;
+
+		ComponentLookupBenchmark() = default;
+
+		template <typename F>
+		static double Measure(F&& lookup)
+		{
+			return Benchmark::MeasureBestNanoseconds(REPETITIONS, [&]()
+			{
+				for (size_t i = 0; i < LOOKUP_COUNT; ++i)
+					Benchmark::DoNotOptimize(lookup());
+			}) / LOOKUP_COUNT;
+		}
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <glad/glad.h>
+
+#define WASTELAND_COUNT_GL(name, ...) Hook<&glad_##name>(#name __VA_OPT__(,) __VA_ARGS__)
+
+namespace Wasteland::Benchmark
+{
+	class GlCallCounter final
+	{
+
+	public:
+
+		GlCallCounter()
+		{
+			WASTELAND_COUNT_GL(glActiveTexture);
+			WASTELAND_COUNT_GL(glAttachShader);
+			WASTELAND_COUNT_GL(glBindBuffer);
+			WASTELAND_COUNT_GL(glBindBufferRange);
+			WASTELAND_COUNT_GL(glBindTexture);
+			WASTELAND_COUNT_GL(glBindVertexArray);
+			WASTELAND_COUNT_GL(glBufferData, &BufferData);
+			WASTELAND_COUNT_GL(glClear);
+			WASTELAND_COUNT_GL(glClearColor);
+			WASTELAND_COUNT_GL(glClientWaitSync, &ClientWaitSync);
+			WASTELAND_COUNT_GL(glCompileShader);
+			WASTELAND_COUNT_GL(glCreateProgram, &CreateObject);
+			WASTELAND_COUNT_GL(glCreateShader, &CreateShader);
+			WASTELAND_COUNT_GL(glDeleteBuffers);
+			WASTELAND_COUNT_GL(glDeleteProgram);
+			WASTELAND_COUNT_GL(glDeleteShader);
+			WASTELAND_COUNT_GL(glDeleteSync);
+			WASTELAND_COUNT_GL(glDeleteTextures);
+			WASTELAND_COUNT_GL(glDeleteVertexArrays);
+			WASTELAND_COUNT_GL(glDrawElements);
+			WASTELAND_COUNT_GL(glEnableVertexAttribArray);
+			WASTELAND_COUNT_GL(glFenceSync, &FenceSync);
+			WASTELAND_COUNT_GL(glFlush);
+			WASTELAND_COUNT_GL(glGenBuffers, &GenerateObjects);
+			WASTELAND_COUNT_GL(glGenTextures, &GenerateObjects);
+			WASTELAND_COUNT_GL(glGenVertexArrays, &GenerateObjects);
+			WASTELAND_COUNT_GL(glGenerateMipmap);
+			WASTELAND_COUNT_GL(glGetActiveUniform);
+			WASTELAND_COUNT_GL(glGetError);
+			WASTELAND_COUNT_GL(glGetIntegerv, &GetIntegerv);
+			WASTELAND_COUNT_GL(glGetProgramInfoLog);
+			WASTELAND_COUNT_GL(glGetProgramiv, &GetObjectiv);
+			WASTELAND_COUNT_GL(glGetShaderInfoLog);
+			WASTELAND_COUNT_GL(glGetShaderiv, &GetObjectiv);
+			WASTELAND_COUNT_GL(glGetUniformBlockIndex);
+			WASTELAND_COUNT_GL(glGetUniformLocation);
+			WASTELAND_COUNT_GL(glLinkProgram);
+			WASTELAND_COUNT_GL(glMapBufferRange, &MapBufferRange);
+			WASTELAND_COUNT_GL(glShaderSource);
+			WASTELAND_COUNT_GL(glTexImage2D);
+			WASTELAND_COUNT_GL(glTexParameteri);
+			WASTELAND_COUNT_GL(glUniform1f);
+			WASTELAND_COUNT_GL(glUniform1i);
+			WASTELAND_COUNT_GL(glUniform2f);
+			WASTELAND_COUNT_GL(glUniform2i);
+			WASTELAND_COUNT_GL(glUniform3f);
+			WASTELAND_COUNT_GL(glUniform3i);
+			WASTELAND_COUNT_GL(glUniformBlockBinding);
+			WASTELAND_COUNT_GL(glUniformMatrix4fv);
+			WASTELAND_COUNT_GL(glUnmapBuffer, &UnmapBuffer);
+			WASTELAND_COUNT_GL(glUseProgram);
+			WASTELAND_COUNT_GL(glVertexAttribPointer);
+			WASTELAND_COUNT_GL(glViewport);
+		}
+
+		GlCallCounter(const GlCallCounter&) = delete;
+		GlCallCounter(GlCallCounter&&) = delete;
+		GlCallCounter& operator=(const GlCallCounter&) = delete;
+		GlCallCounter& operator=(GlCallCounter&&) = delete;
+
+		~GlCallCounter()
+		{
+			for (Entry& entry : entries)
+				entry.restore();
+		}
+
+		void Reset()
+		{
+			for (Entry& entry : entries)
+				*entry.count = 0;
+		}
+
+		size_t GetTotal() const
+		{
+			size_t total = 0;
+
+			for (const Entry& entry : entries)
+				total += *entry.count;
+
+			return total;
+		}
+
+		std::vector<std::pair<std::string_view, size_t>> GetCounts() const
+		{
+			std::vector<std::pair<std::string_view, size_t>> result;
+
+			for (const Entry& entry : entries)
+			{
+				if (*entry.count > 0)
+					result.emplace_back(entry.name, *entry.count);
+			}
+
+			std::sort(result.begin(), result.end(), [](const auto& left, const auto& right) { return left.second > right.second; });
+
+			return result;
+		}
+
+	private:
+
+		struct Entry
+		{
+			std::string_view name;
+
+			size_t* count;
+
+			std::function<void()> restore;
+		};
+
+		template <auto* Pointer, typename F = std::remove_pointer_t<decltype(Pointer)>>
+		struct Stub;
+
+		template <auto* Pointer, typename R, typename... A>
+		struct Stub<Pointer, R (APIENTRY*)(A...)>
+		{
+			using Function = R (APIENTRY*)(A...);
+
+			static R APIENTRY Call(A... arguments)
+			{
+				++count;
+
+				if (behaviour)
+					return behaviour(arguments...);
+
+				if constexpr (!std::is_void_v<R>)
+					return R{ };
+			}
+
+			static inline size_t count = 0;
+
+			static inline Function behaviour = nullptr;
+		};
+
+		template <auto* Pointer>
+		void Hook(std::string_view name, typename Stub<Pointer>::Function behaviour = nullptr)
+		{
+			auto original = *Pointer;
+
+			Stub<Pointer>::count = 0;
+			Stub<Pointer>::behaviour = behaviour;
+
+			*Pointer = &Stub<Pointer>::Call;
+
+			entries.push_back({ name, &Stub<Pointer>::count, [original]() { *Pointer = original; } });
+		}
+
+		static void APIENTRY BufferData(GLenum, GLsizeiptr size, const void*, GLenum)
+		{
+			mappedMemory.resize(std::max(mappedMemory.size(), static_cast<size_t>(size)));
+		}
+
+		static GLenum APIENTRY ClientWaitSync(GLsync, GLbitfield, GLuint64)
+		{
+			return GL_ALREADY_SIGNALED;
+		}
+
+		static GLuint APIENTRY CreateObject()
+		{
+			return ++nextObject;
+		}
+
+		static GLuint APIENTRY CreateShader(GLenum)
+		{
+			return ++nextObject;
+		}
+
+		static GLsync APIENTRY FenceSync(GLenum, GLbitfield)
+		{
+			return reinterpret_cast<GLsync>(&fenceObject);
+		}
+
+		static void APIENTRY GenerateObjects(GLsizei count, GLuint* objects)
+		{
+			for (GLsizei i = 0; i < count; ++i)
+				objects[i] = ++nextObject;
+		}
+
+		static void APIENTRY GetIntegerv(GLenum name, GLint* value)
+		{
+			*value = name == GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT ? 256 : 0;
+		}
+
+		static void APIENTRY GetObjectiv(GLuint, GLenum name, GLint* value)
+		{
+			*value = name == GL_COMPILE_STATUS || name == GL_LINK_STATUS ? GL_TRUE : 0;
+		}
+
+		static void* APIENTRY MapBufferRange(GLenum, GLintptr, GLsizeiptr length, GLbitfield)
+		{
+			mappedMemory.resize(std::max(mappedMemory.size(), static_cast<size_t>(length)));
+
+			return mappedMemory.data();
+		}
+
+		static GLboolean APIENTRY UnmapBuffer(GLenum)
+		{
+			return GL_TRUE;
+		}
+
+		std::vector<Entry> entries;
+
+		static inline std::vector<std::byte> mappedMemory;
+
+		static inline GLuint nextObject = 0;
+
+		static inline std::byte fenceObject{ };
+
+	};
+}
+
+#undef WASTELAND_COUNT_GL
\ No newline at end of file
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "Thread/JobSystem.hpp"
+
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Benchmark
+{
+	class LegacyThreadPool final
+	{
+
+	public:
+
+		explicit LegacyThreadPool(size_t workerCount)
+		{
+			for (size_t i = 0; i < workerCount; ++i)
+				workers.emplace_back(&LegacyThreadPool::WorkerThread, this);
+		}
+
+		LegacyThreadPool(const LegacyThreadPool&) = delete;
+		LegacyThreadPool(LegacyThreadPool&&) = delete;
+		LegacyThreadPool& operator=(const LegacyThreadPool&) = delete;
+		LegacyThreadPool& operator=(LegacyThreadPool&&) = delete;
+
+		~LegacyThreadPool()
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				stop = true;
+			}
+
+			conditionVariable.notify_all();
+
+			for (auto& worker : workers)
+				worker.join();
+		}
+
+		void EnqueueTask(std::function<void()> task)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				tasks.push(std::move(task));
+			}
+
+			conditionVariable.notify_one();
+		}
+
+	private:
+
+		void WorkerThread()
+		{
+			while (true)
+			{
+				std::function<void()> task;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+
+					conditionVariable.wait(lock, [this] { return !tasks.empty() || stop; });
+
+					if (stop && tasks.empty())
+						return;
+
+					task = std::move(tasks.front());
+
+					tasks.pop();
+				}
+
+				task();
+			}
+		}
+
+		std::vector<std::thread> workers;
+
+		std::mutex mutex;
+		std::condition_variable conditionVariable;
+		std::queue<std::function<void()>> tasks;
+
+		bool stop = false;
+
+	};
+
+	class JobSystemBenchmark final
+	{
+
+	public:
+
+		JobSystemBenchmark(const JobSystemBenchmark&) = delete;
+		JobSystemBenchmark(JobSystemBenchmark&&) = delete;
+		JobSystemBenchmark& operator=(const JobSystemBenchmark&) = delete;
+		JobSystemBenchmark& operator=(JobSystemBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("JobSystem vs legacy ThreadPool");
+
+			for (size_t threads : Benchmark::GetThreadCounts())
+			{
+				double legacyThroughput;
+				std::vector<double> legacyLatencies;
+
+				{
+					LegacyThreadPool pool(threads);
+
+					legacyThroughput = MeasureThroughput([&pool](auto job) { pool.EnqueueTask(job); });
+					legacyLatencies = MeasureLatencies([&pool](auto job) { pool.EnqueueTask(job); });
+				}
+
+				JobSystem::GetInstance().Initialize(threads);
+
+				double jobThroughput = MeasureThroughput([](auto job) { JobSystem::GetInstance().Submit(job); });
+				std::vector<double> jobLatencies = MeasureLatencies([](auto job) { JobSystem::GetInstance().Submit(job); });
+
+				Benchmark::Print("{:>2} workers  throughput: legacy {:7.1f} ns/job, job system {:7.1f} ns/job", threads, legacyThroughput, jobThroughput);
+				Benchmark::Print("{:>2} workers  latency p50: legacy {:7.0f} ns,     job system {:7.0f} ns", threads, Benchmark::GetPercentile(legacyLatencies, 0.5), Benchmark::GetPercentile(jobLatencies, 0.5));
+				Benchmark::Print("{:>2} workers  latency p99: legacy {:7.0f} ns,     job system {:7.0f} ns", threads, Benchmark::GetPercentile(legacyLatencies, 0.99), Benchmark::GetPercentile(jobLatencies, 0.99));
+			}
+
+			JobSystem::GetInstance().Initialize(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+		}
+
+	private:
+
+		static constexpr size_t THROUGHPUT_JOB_COUNT = 200000;
+		static constexpr size_t LATENCY_SAMPLE_COUNT = 2000;
+
+		JobSystemBenchmark() = default;
+
+		template <typename Submit>
+		static double MeasureThroughput(Submit&& submit)
+		{
+			std::atomic<size_t> completed = 0;
+
+			double elapsed = Benchmark::MeasureNanoseconds([&]()
+			{
+				for (size_t i = 0; i < THROUGHPUT_JOB_COUNT; ++i)
+					submit([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+
+				while (completed.load(std::memory_order_acquire) < THROUGHPUT_JOB_COUNT)
+					std::this_thread::yield();
+			});
+
+			return elapsed / THROUGHPUT_JOB_COUNT;
+		}
+
+		template <typename Submit>
+		static std::vector<double> MeasureLatencies(Submit&& submit)
+		{
+			std::vector<double> latencies;
+
+			latencies.reserve(LATENCY_SAMPLE_COUNT);
+
+			for (size_t i = 0; i < LATENCY_SAMPLE_COUNT; ++i)
+			{
+				std::atomic<bool> started = false;
+
+				Benchmark::Clock::time_point startTime;
+				Benchmark::Clock::time_point submitTime = Benchmark::Clock::now();
+
+				submit([&started, &startTime]()
+				{
+					startTime = Benchmark::Clock::now();
+					started.store(true, std::memory_order_release);
+				});
+
+				while (!started.load(std::memory_order_acquire))
+					std::this_thread::yield();
+
+				latencies.push_back(std::chrono::duration<double, std::nano>(startTime - submitTime).count());
+
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+			}
+
+			return latencies;
+		}
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "Benchmark/MpscRingBuffer.hpp"
+#include "Thread/MainThreadExecutor.hpp"
+#include "Thread/TaskSlotPool.hpp"
+
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Benchmark
+{
+	class RingMainThreadExecutor final
+	{
+
+	public:
+
+		RingMainThreadExecutor() : ring(RING_CAPACITY) { }
+
+		RingMainThreadExecutor(const RingMainThreadExecutor&) = delete;
+		RingMainThreadExecutor(RingMainThreadExecutor&&) = delete;
+		RingMainThreadExecutor& operator=(const RingMainThreadExecutor&) = delete;
+		RingMainThreadExecutor& operator=(RingMainThreadExecutor&&) = delete;
+
+		TaskHandle EnqueueTask(Job task, TaskPriority priority = TaskPriority::NORMAL)
+		{
+			uint32_t index = slots.Acquire();
+
+			auto& slot = slots.Get(index);
+
+			slot.payload.task = std::move(task);
+			slot.payload.priority = priority;
+
+			uint32_t generation = SlotPool::GetGeneration(slot.stamp.load(std::memory_order_relaxed));
+
+			slot.stamp.store(SlotPool::MakeStamp(generation, SlotPool::STATE_QUEUED), std::memory_order_release);
+
+			if (!ring.TryPush(index))
+			{
+				std::lock_guard<std::mutex> lock(overflowMutex);
+
+				overflowTasks.push_back(index);
+				overflowCount.fetch_add(1, std::memory_order_release);
+			}
+
+			return { index, generation };
+		}
+
+		void Execute()
+		{
+			auto start = std::chrono::steady_clock::now();
+
+			Drain();
+
+			while (true)
+			{
+				Job task;
+
+				if (!PopReady(task))
+					break;
+
+				task();
+
+				if (std::chrono::steady_clock::now() - start >= frameBudget)
+					break;
+			}
+		}
+
+		void SetFrameBudget(std::chrono::microseconds budget)
+		{
+			frameBudget = budget;
+		}
+
+	private:
+
+		static constexpr size_t RING_CAPACITY = 4096;
+
+		struct TaskRecord
+		{
+			Job task;
+
+			TaskPriority priority = TaskPriority::NORMAL;
+		};
+
+		using SlotPool = TaskSlotPool<TaskRecord>;
+
+		void Drain()
+		{
+			uint32_t index;
+
+			while (ring.TryPop(index))
+				queues[static_cast<size_t>(slots.Get(index).payload.priority)].push_back(index);
+
+			if (overflowCount.load(std::memory_order_acquire) == 0)
+				return;
+
+			std::vector<uint32_t> overflow;
+
+			{
+				std::lock_guard<std::mutex> lock(overflowMutex);
+
+				overflow.swap(overflowTasks);
+				overflowCount.store(0, std::memory_order_relaxed);
+			}
+
+			for (uint32_t overflowIndex : overflow)
+				queues[static_cast<size_t>(slots.Get(overflowIndex).payload.priority)].push_back(overflowIndex);
+		}
+
+		bool PopReady(Job& task)
+		{
+			for (auto& queue : queues)
+			{
+				while (!queue.empty())
+				{
+					uint32_t index = queue.front();
+
+					queue.pop_front();
+
+					auto& slot = slots.Get(index);
+
+					uint64_t stamp = slot.stamp.load(std::memory_order_acquire);
+
+					uint64_t running = SlotPool::MakeStamp(SlotPool::GetGeneration(stamp), SlotPool::STATE_RUNNING);
+
+					bool isRunnable = SlotPool::GetState(stamp) == SlotPool::STATE_QUEUED && slot.stamp.compare_exchange_strong(stamp, running, std::memory_order_acq_rel);
+
+					if (isRunnable)
+						task = std::move(slot.payload.task);
+
+					slot.payload.task.Reset();
+					slots.Release(index);
+
+					if (isRunnable)
+						return true;
+				}
+			}
+
+			return false;
+		}
+
+		SlotPool slots;
+
+		MpscRingBuffer<uint32_t> ring;
+
+		std::mutex overflowMutex;
+		std::vector<uint32_t> overflowTasks;
+		std::atomic<size_t> overflowCount = 0;
+
+		std::array<std::deque<uint32_t>, 3> queues;
+
+		std::chrono::microseconds frameBudget = std::chrono::microseconds(4000);
+
+	};
+
+	class MainThreadExecutorBenchmark final
+	{
+
+	public:
+
+		MainThreadExecutorBenchmark(const MainThreadExecutorBenchmark&) = delete;
+		MainThreadExecutorBenchmark(MainThreadExecutorBenchmark&&) = delete;
+		MainThreadExecutorBenchmark& operator=(const MainThreadExecutorBenchmark&) = delete;
+		MainThreadExecutorBenchmark& operator=(MainThreadExecutorBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("MainThreadExecutor mutex queue vs MPSC ring");
+
+			MainThreadExecutor& executor = MainThreadExecutor::GetInstance();
+
+			std::chrono::microseconds previousBudget = executor.GetFrameBudget();
+
+			executor.BindToCurrentThread();
+			executor.SetFrameBudget(FRAME_BUDGET);
+
+			for (size_t producers : PRODUCER_COUNTS)
+			{
+				RingMainThreadExecutor ring;
+
+				ring.SetFrameBudget(FRAME_BUDGET);
+
+				double mutexTime = Measure(producers, [&executor](Job job) { executor.EnqueueTask(std::move(job)); }, [&executor]() { executor.Execute(); });
+				double ringTime = Measure(producers, [&ring](Job job) { ring.EnqueueTask(std::move(job)); }, [&ring]() { ring.Execute(); });
+
+				Benchmark::Print("{:>2} producers  mutex queue {:7.1f} ns/task, ring {:7.1f} ns/task", producers, mutexTime, ringTime);
+			}
+
+			executor.SetFrameBudget(previousBudget);
+		}
+
+	private:
+
+		static constexpr size_t TASK_COUNT = 256000;
+		static constexpr size_t REPETITIONS = 5;
+
+		static constexpr std::chrono::microseconds FRAME_BUDGET = std::chrono::seconds(10);
+
+		static constexpr std::array<size_t, 6> PRODUCER_COUNTS = { 1, 2, 4, 8, 16, 32 };
+
+		MainThreadExecutorBenchmark() = default;
+
+		template <typename Enqueue, typename Execute>
+		static double Measure(size_t producerCount, Enqueue&& enqueue, Execute&& execute)
+		{
+			double elapsed = Benchmark::MeasureBestNanoseconds(REPETITIONS, [&]()
+			{
+				std::atomic<size_t> completed = 0;
+
+				std::vector<std::thread> producers;
+
+				for (size_t i = 0; i < producerCount; ++i)
+				{
+					producers.emplace_back([&, i]()
+					{
+						for (size_t j = i; j < TASK_COUNT; j += producerCount)
+							enqueue(Job([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); }));
+					});
+				}
+
+				while (completed.load(std::memory_order_relaxed) < TASK_COUNT)
+					execute();
+
+				for (auto& producer : producers)
+					producer.join();
+			});
+
+			return elapsed / TASK_COUNT;
+		}
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Wasteland::Benchmark
+{
+	template <typename T>
+	class MpscRingBuffer final
+	{
+
+	public:
+
+		explicit MpscRingBuffer(size_t capacity) : mask(capacity - 1), cells(new Cell[capacity])
+		{
+			for (size_t i = 0; i < capacity; ++i)
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		MpscRingBuffer(const MpscRingBuffer&) = delete;
+		MpscRingBuffer(MpscRingBuffer&&) = delete;
+		MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+		MpscRingBuffer& operator=(MpscRingBuffer&&) = delete;
+
+		bool TryPush(const T& value)
+		{
+			size_t position = enqueuePosition.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				Cell& cell = cells[position & mask];
+
+				size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+				intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (difference == 0)
+				{
+					if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						cell.value = value;
+						cell.sequence.store(position + 1, std::memory_order_release);
+
+						return true;
+					}
+				}
+				else if (difference < 0)
+					return false;
+				else
+					position = enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		bool TryPop(T& value)
+		{
+			Cell& cell = cells[dequeuePosition & mask];
+
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+			if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeuePosition + 1) < 0)
+				return false;
+
+			value = cell.value;
+
+			cell.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+
+			++dequeuePosition;
+
+			return true;
+		}
+
+	private:
+
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			T value;
+		};
+
+		const size_t mask;
+
+		std::unique_ptr<Cell[]> cells;
+
+		alignas(64) std::atomic<size_t> enqueuePosition = 0;
+		alignas(64) size_t dequeuePosition = 0;
+
+	};
+}
\ No newline at end of file
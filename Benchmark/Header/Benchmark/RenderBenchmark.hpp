@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "Benchmark/GlCallCounter.hpp"
+#include "Core/Window.hpp"
+#include "Math/Matrix.hpp"
+#include "Render/RenderCommandQueue.hpp"
+#include "Render/RenderSnapshot.hpp"
+#include "Render/Shader.hpp"
+#include "Render/Texture.hpp"
+
+using namespace Wasteland::Core;
+using namespace Wasteland::Math;
+using namespace Wasteland::Render;
+
+namespace Wasteland::Benchmark
+{
+	class RenderBenchmark final
+	{
+
+	public:
+
+		RenderBenchmark(const RenderBenchmark&) = delete;
+		RenderBenchmark(RenderBenchmark&&) = delete;
+		RenderBenchmark& operator=(const RenderBenchmark&) = delete;
+		RenderBenchmark& operator=(RenderBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("GL calls per presented frame");
+
+			GlCallCounter counter;
+
+			std::shared_ptr<Shader> shader = Shader::Create("default", { "Wasteland", "Shader/Default" });
+			std::shared_ptr<Texture> texture = Texture::Create("debug", { "Wasteland", "Texture/Debug.png" });
+
+			std::shared_ptr<MeshBuffers> buffers = std::make_shared<MeshBuffers>();
+
+			buffers->Upload({ Vertex{ }, Vertex{ }, Vertex{ } }, { 0, 1, 2 });
+
+			for (size_t itemCount : ITEM_COUNTS)
+			{
+				RenderSnapshot snapshot;
+
+				for (size_t i = 0; i < itemCount; ++i)
+					snapshot.items.push_back({ buffers, shader, texture, Matrix<float, 4, 4>::Translation({ static_cast<float>(i), 0.0f, 0.0f }) });
+
+				for (size_t i = 0; i < WARMUP_FRAMES; ++i)
+					Present(snapshot);
+
+				counter.Reset();
+
+				for (size_t i = 0; i < MEASURED_FRAMES; ++i)
+					Present(snapshot);
+
+				Benchmark::Print("{:>5} draws  {:>8.1f} calls/frame  {:>5.2f} calls/draw", itemCount, static_cast<double>(counter.GetTotal()) / MEASURED_FRAMES, static_cast<double>(counter.GetTotal()) / MEASURED_FRAMES / itemCount);
+			}
+
+			Benchmark::Print("breakdown at {} draws:", ITEM_COUNTS.back());
+
+			for (const auto& [name, count] : counter.GetCounts())
+				Benchmark::Print("      {:<24} {:>8.1f}/frame", name, static_cast<double>(count) / MEASURED_FRAMES);
+		}
+
+	private:
+
+		static constexpr std::array<size_t, 4> ITEM_COUNTS = { 1, 64, 1024, 4096 };
+
+		static constexpr size_t WARMUP_FRAMES = 4;
+		static constexpr size_t MEASURED_FRAMES = 32;
+
+		RenderBenchmark() = default;
+
+		static void Present(const RenderSnapshot& snapshot)
+		{
+			RenderCommandQueue::GetInstance().ExecutePending();
+
+			Window::GetInstance().Clear();
+
+			snapshot.Draw();
+		}
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+using namespace Wasteland::Math;
+
+namespace Wasteland::Benchmark
+{
+	class SimdBenchmark final
+	{
+
+	public:
+
+		SimdBenchmark(const SimdBenchmark&) = delete;
+		SimdBenchmark(SimdBenchmark&&) = delete;
+		SimdBenchmark& operator=(const SimdBenchmark&) = delete;
+		SimdBenchmark& operator=(SimdBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("SIMD 4x4 matrix and float4 kernels vs scalar code");
+
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+			std::vector<Matrix<float, 4, 4>> matrices(COUNT);
+			std::vector<Matrix<float, 4, 4>> results(COUNT);
+			std::vector<Vector<float, 4>> vectors(COUNT);
+			std::vector<Vector<float, 4>> vectorResults(COUNT);
+
+			for (size_t i = 0; i < COUNT; ++i)
+			{
+				matrices[i] = Matrix<float, 4, 4>::TranslationRotationScale({ distribution(random), distribution(random), distribution(random) }, Quaternion<float>::Identity(), { 1.0f + distribution(random) * 0.5f, 1.0f, 1.0f });
+
+				for (size_t c = 0; c < 4; ++c)
+				{
+					for (size_t r = 0; r < 3; ++r)
+						matrices[i][c][r] += distribution(random) * 0.25f;
+				}
+
+				vectors[i] = { distribution(random), distribution(random), distribution(random), 1.0f };
+			}
+
+			Report("matrix multiply", Measure([&](size_t i) { results[i] = matrices[i] * matrices[(i + 7) % COUNT]; }), Measure([&](size_t i) { results[i] = MultiplyScalar(matrices[i], matrices[(i + 7) % COUNT]); }));
+			Report("matrix * vector", Measure([&](size_t i) { vectorResults[i] = matrices[i] * vectors[i]; }), Measure([&](size_t i) { vectorResults[i] = TransformScalar(matrices[i], vectors[i]); }));
+			Report("transpose", Measure([&](size_t i) { results[i] = Matrix<float, 4, 4>::Transpose(matrices[i]); }), Measure([&](size_t i) { results[i] = TransposeScalar(matrices[i]); }));
+			Report("float4 normalize", Measure([&](size_t i) { vectorResults[i] = Vector<float, 4>::Normalize(vectors[i]); }), Measure([&](size_t i) { vectorResults[i] = NormalizeScalar(vectors[i]); }));
+
+			Benchmark::Print("{:<18} SIMD {:6.2f} ns", "inverse", Measure([&](size_t i) { results[i] = Matrix<float, 4, 4>::Inverse(matrices[i]); }));
+
+			Benchmark::DoNotOptimize(results);
+			Benchmark::DoNotOptimize(vectorResults);
+		}
+
+	private:
+
+		static constexpr size_t COUNT = 1024;
+		static constexpr size_t REPETITIONS = 200;
+
+		SimdBenchmark() = default;
+
+		template <typename F>
+		static double Measure(F&& operation)
+		{
+			return Benchmark::MeasureBestNanoseconds(REPETITIONS, [&]()
+			{
+				for (size_t i = 0; i < COUNT; ++i)
+					operation(i);
+			}) / COUNT;
+		}
+
+		static void Report(const char* name, double simd, double scalar)
+		{
+			Benchmark::Print("{:<18} SIMD {:6.2f} ns, scalar {:6.2f} ns ({:.2f}x)", name, simd, scalar, scalar / simd);
+		}
+
+		static Matrix<float, 4, 4> MultiplyScalar(const Matrix<float, 4, 4>& first, const Matrix<float, 4, 4>& second)
+		{
+			Matrix<float, 4, 4> result;
+
+			for (size_t j = 0; j < 4; ++j)
+			{
+				for (size_t i = 0; i < 4; ++i)
+				{
+					float sum = 0.0f;
+
+					for (size_t k = 0; k < 4; ++k)
+						sum += first[k][i] * second[j][k];
+
+					result[j][i] = sum;
+				}
+			}
+
+			return result;
+		}
+
+		static Vector<float, 4> TransformScalar(const Matrix<float, 4, 4>& matrix, const Vector<float, 4>& vector)
+		{
+			Vector<float, 4> result;
+
+			for (size_t i = 0; i < 4; ++i)
+			{
+				float sum = 0.0f;
+
+				for (size_t k = 0; k < 4; ++k)
+					sum += matrix[k][i] * vector[k];
+
+				result[i] = sum;
+			}
+
+			return result;
+		}
+
+		static Matrix<float, 4, 4> TransposeScalar(const Matrix<float, 4, 4>& matrix)
+		{
+			Matrix<float, 4, 4> result;
+
+			for (size_t c = 0; c < 4; ++c)
+			{
+				for (size_t r = 0; r < 4; ++r)
+					result[r][c] = matrix[c][r];
+			}
+
+			return result;
+		}
+
+		static Vector<float, 4> NormalizeScalar(const Vector<float, 4>& vector)
+		{
+			float magnitude = std::sqrt(vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2] + vector[3] * vector[3]);
+
+			Vector<float, 4> result;
+
+			for (size_t i = 0; i < 4; ++i)
+				result[i] = vector[i] / magnitude;
+
+			return result;
+		}
+
+	};
+}
\ No newline at end of file
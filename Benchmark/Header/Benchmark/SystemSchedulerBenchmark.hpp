@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "ECS/Dependency.hpp"
+#include "ECS/GameObjectManager.hpp"
+#include "ECS/SystemScheduler.hpp"
+
+using namespace Wasteland::ECS;
+using namespace Wasteland::Math;
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Benchmark
+{
+	class OrbitComponent final : public Component
+	{
+
+	public:
+
+		void Update() override
+		{
+			angle += 0.01f;
+
+			transform->SetLocalPosition({ std::cos(angle) * radius, std::sin(angle * 0.5f), std::sin(angle) * radius }, false);
+		}
+
+		static SystemAccess GetSystemAccess()
+		{
+			return SystemAccess().Write<Transform>().Parallel(UPDATE_GRAIN_SIZE);
+		}
+
+		static constexpr size_t UPDATE_GRAIN_SIZE = 256;
+
+		float angle = 0.0f;
+		float radius = 1.0f;
+
+	private:
+
+		Dependency<Transform> transform{ this };
+
+	};
+
+	class PulseComponent final : public Component
+	{
+
+	public:
+
+		void Update() override
+		{
+			phase += 0.02f;
+
+			for (float& sample : samples)
+				sample = std::sin(phase + sample);
+		}
+
+		static SystemAccess GetSystemAccess()
+		{
+			return SystemAccess().Parallel(OrbitComponent::UPDATE_GRAIN_SIZE);
+		}
+
+		float phase = 0.0f;
+
+		float samples[8] = { };
+
+	};
+
+	class SystemSchedulerBenchmark final
+	{
+
+	public:
+
+		SystemSchedulerBenchmark(const SystemSchedulerBenchmark&) = delete;
+		SystemSchedulerBenchmark(SystemSchedulerBenchmark&&) = delete;
+		SystemSchedulerBenchmark& operator=(const SystemSchedulerBenchmark&) = delete;
+		SystemSchedulerBenchmark& operator=(SystemSchedulerBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("SystemScheduler frame update, 50k objects");
+
+			std::vector<EntityHandle> objects;
+
+			objects.reserve(OBJECT_COUNT);
+
+			for (size_t i = 0; i < OBJECT_COUNT; ++i)
+			{
+				auto gameObject = GameObject::Create();
+
+				gameObject->AddComponent(std::make_shared<OrbitComponent>())->radius = static_cast<float>(i % 100);
+				gameObject->AddComponent(std::make_shared<PulseComponent>());
+
+				objects.push_back(GameObjectManager::GetInstance().Register(gameObject)->GetHandle());
+			}
+
+			GameObjectManager::GetInstance().Update();
+
+			SystemScheduler& scheduler = SystemScheduler::GetInstance();
+
+			for (size_t threads : Benchmark::GetThreadCounts())
+			{
+				JobSystem::GetInstance().Initialize(threads);
+
+				scheduler.SetExecutionMode(SystemExecutionMode::SEQUENTIAL);
+
+				double sequential = MeasureFrame();
+
+				scheduler.SetExecutionMode(SystemExecutionMode::PARALLEL);
+
+				double parallel = MeasureFrame();
+
+				SystemSchedulerStatistics statistics = scheduler.GetStatistics();
+
+				Benchmark::Print("{:>2} workers  sequential {:7.3f} ms, parallel {:7.3f} ms, speedup {:.2f}x ({} systems in {} batches)", threads, sequential, parallel, sequential / parallel, statistics.systemCount, statistics.batchCount);
+			}
+
+			for (EntityHandle object : objects)
+				GameObjectManager::GetInstance().Unregister(object);
+
+			GameObjectManager::GetInstance().Update();
+			GameObjectManager::GetInstance().Uninitialize();
+
+			JobSystem::GetInstance().Initialize(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+		}
+
+	private:
+
+		static constexpr size_t OBJECT_COUNT = 50000;
+		static constexpr size_t FRAME_COUNT = 20;
+
+		SystemSchedulerBenchmark() = default;
+
+		static double MeasureFrame()
+		{
+			GameObjectManager::GetInstance().Update();
+
+			return Benchmark::MeasureBestNanoseconds(FRAME_COUNT, []() { GameObjectManager::GetInstance().Update(); }) / 1000000.0;
+		}
+
+	};
+}
\ No newline at end of file
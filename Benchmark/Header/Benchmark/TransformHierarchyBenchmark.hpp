@@ -0,0 +1,161 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Benchmark/Benchmark.hpp"
+#include "Math/TransformHierarchy.hpp"
+
+using namespace Wasteland::Math;
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Benchmark
+{
+	class TransformHierarchyBenchmark final
+	{
+
+	public:
+
+		TransformHierarchyBenchmark(const TransformHierarchyBenchmark&) = delete;
+		TransformHierarchyBenchmark(TransformHierarchyBenchmark&&) = delete;
+		TransformHierarchyBenchmark& operator=(const TransformHierarchyBenchmark&) = delete;
+		TransformHierarchyBenchmark& operator=(TransformHierarchyBenchmark&&) = delete;
+
+		static void Run()
+		{
+			Benchmark::PrintHeader("TransformHierarchy update, every node dirty");
+
+			TransformHierarchy& hierarchy = TransformHierarchy::GetInstance();
+
+			size_t defaultThreshold = hierarchy.GetParallelThreshold();
+
+			for (size_t threads : Benchmark::GetThreadCounts())
+			{
+				JobSystem::GetInstance().Initialize(threads);
+
+				for (const Shape& shape : SHAPES)
+				{
+					std::vector<std::shared_ptr<Transform>> transforms = Build(shape.roots, shape.depth, shape.fanOut);
+
+					double serial = Measure(transforms, std::numeric_limits<size_t>::max());
+					double parallel = Measure(transforms, 0);
+
+					Benchmark::Print("{:>2} workers  {:<6} {:>6} nodes  serial {:8.1f} us, parallel {:8.1f} us", threads, shape.name, transforms.size(), serial, parallel);
+
+					Release(transforms);
+				}
+
+				for (size_t roots = SWEEP_MINIMUM_ROOTS; roots <= SWEEP_MAXIMUM_ROOTS; roots *= 2)
+				{
+					std::vector<std::shared_ptr<Transform>> transforms = Build(roots, 1, SWEEP_FAN_OUT);
+
+					double serial = Measure(transforms, std::numeric_limits<size_t>::max());
+					double parallel = Measure(transforms, 0);
+
+					Benchmark::Print("{:>2} workers  sweep  {:>6} nodes  serial {:8.1f} us, parallel {:8.1f} us", threads, transforms.size(), serial, parallel);
+
+					Release(transforms);
+				}
+			}
+
+			hierarchy.SetParallelThreshold(defaultThreshold);
+
+			JobSystem::GetInstance().Initialize(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+		}
+
+	private:
+
+		struct Shape
+		{
+			const char* name;
+
+			size_t roots;
+			size_t depth;
+			size_t fanOut;
+		};
+
+		static constexpr Shape SHAPES[] =
+		{
+			{ "deep", 100, 1000, 1 },
+			{ "wide", 10000, 1, 9 }
+		};
+
+		static constexpr size_t SWEEP_MINIMUM_ROOTS = 64;
+		static constexpr size_t SWEEP_MAXIMUM_ROOTS = 4096;
+		static constexpr size_t SWEEP_FAN_OUT = 7;
+
+		static constexpr size_t REPETITIONS = 10;
+
+		TransformHierarchyBenchmark() = default;
+
+		static std::vector<std::shared_ptr<Transform>> Build(size_t roots, size_t depth, size_t fanOut)
+		{
+			std::vector<std::shared_ptr<Transform>> transforms;
+
+			for (size_t i = 0; i < roots; ++i)
+			{
+				transforms.push_back(CreateTransform());
+
+				std::shared_ptr<Transform> parent = transforms.back();
+
+				for (size_t level = 1; level < depth; ++level)
+				{
+					transforms.push_back(CreateTransform());
+					transforms.back()->SetParent(parent);
+
+					parent = transforms.back();
+				}
+
+				for (size_t child = 0; child < fanOut && depth == 1; ++child)
+				{
+					transforms.push_back(CreateTransform());
+					transforms.back()->SetParent(parent);
+				}
+			}
+
+			for (size_t i = 0; i < transforms.size(); ++i)
+				TransformHierarchy::GetInstance().Register(transforms[i].get(), static_cast<EntityIndex>(i));
+
+			TransformHierarchy::GetInstance().Update();
+
+			return transforms;
+		}
+
+		static void Release(std::vector<std::shared_ptr<Transform>>& transforms)
+		{
+			for (const auto& transform : transforms)
+				TransformHierarchy::GetInstance().Unregister(transform.get());
+
+			for (auto transform = transforms.rbegin(); transform != transforms.rend(); ++transform)
+				transform->reset();
+
+			transforms.clear();
+
+			TransformHierarchy::GetInstance().Update();
+		}
+
+		static std::shared_ptr<Transform> CreateTransform()
+		{
+			return Transform::Create({ 1.0f, 0.5f, 0.0f }, Quaternion<float>::Identity(), { 1.0f, 1.0f, 1.0f });
+		}
+
+		static double Measure(const std::vector<std::shared_ptr<Transform>>& transforms, size_t threshold)
+		{
+			TransformHierarchy::GetInstance().SetParallelThreshold(threshold);
+
+			double best = std::numeric_limits<double>::max();
+
+			for (size_t repetition = 0; repetition < REPETITIONS; ++repetition)
+			{
+				for (const auto& transform : transforms)
+					transform->SetLocalPosition(transform->GetLocalPosition(), false);
+
+				best = std::min(best, Benchmark::MeasureNanoseconds([]() { TransformHierarchy::GetInstance().Update(); }));
+			}
+
+			return best / 1000.0;
+		}
+
+	};
+}
\ No newline at end of file
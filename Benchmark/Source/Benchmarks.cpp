@@ -0,0 +1,50 @@
+#include <string_view>
+#include "Benchmark/BatchMathBenchmark.hpp"
+#include "Benchmark/ComponentIterationBenchmark.hpp"
+#include "Benchmark/ComponentLookupBenchmark.hpp"
+#include "Benchmark/JobSystemBenchmark.hpp"
+#include "Benchmark/MainThreadExecutorBenchmark.hpp"
+#include "Benchmark/RenderBenchmark.hpp"
+#include "Benchmark/SimdBenchmark.hpp"
+#include "Benchmark/SystemSchedulerBenchmark.hpp"
+#include "Benchmark/TransformHierarchyBenchmark.hpp"
+
+using namespace Wasteland::Benchmark;
+
+struct BenchmarkEntry
+{
+	std::string_view name;
+
+	void (*run)();
+};
+
+static constexpr BenchmarkEntry BENCHMARKS[] =
+{
+	{ "jobs", &JobSystemBenchmark::Run },
+	{ "mainthread", &MainThreadExecutorBenchmark::Run },
+	{ "systems", &SystemSchedulerBenchmark::Run },
+	{ "components", &ComponentIterationBenchmark::Run },
+	{ "lookup", &ComponentLookupBenchmark::Run },
+	{ "hierarchy", &TransformHierarchyBenchmark::Run },
+	{ "simd", &SimdBenchmark::Run },
+	{ "batch", &BatchMathBenchmark::Run },
+	{ "render", &RenderBenchmark::Run }
+};
+
+int main(int argc, char** argv)
+{
+	for (const BenchmarkEntry& benchmark : BENCHMARKS)
+	{
+		bool isSelected = argc <= 1;
+
+		for (int i = 1; i < argc; ++i)
+			isSelected |= std::string_view(argv[i]) == benchmark.name;
+
+		if (isSelected)
+			benchmark.run();
+	}
+
+	JobSystem::GetInstance().Uninitialize();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <format>
+#include "Math/BatchMath.hpp"
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+#include "Test/Test.hpp"
+
+using namespace Wasteland::Math;
+
+namespace Wasteland::Test
+{
+	class BatchMathTest final
+	{
+
+	public:
+
+		BatchMathTest(const BatchMathTest&) = delete;
+		BatchMathTest(BatchMathTest&&) = delete;
+		BatchMathTest& operator=(const BatchMathTest&) = delete;
+		BatchMathTest& operator=(BatchMathTest&&) = delete;
+
+		static bool Run()
+		{
+			Matrix<float, 4, 4> matrix = Matrix<float, 4, 4>::TranslationRotationScale({ 1.0f, -2.0f, 3.5f }, { 0.18257419f, 0.36514837f, 0.54772256f, 0.73029674f }, { 2.0f, 0.5f, 1.5f });
+
+			std::array<float, COUNT> xs, ys, zs;
+			std::array<float, COUNT> outputXs, outputYs, outputZs;
+
+			std::array<Matrix<float, 4, 4>, COUNT> first, second, products;
+
+			for (size_t i = 0; i < COUNT; ++i)
+			{
+				xs[i] = GetX(i);
+				ys[i] = GetY(i);
+				zs[i] = GetZ(i);
+
+				first[i] = Matrix<float, 4, 4>::RotationY(i * 0.3f) * Matrix<float, 4, 4>::Translation({ xs[i], ys[i], zs[i] });
+				second[i] = Matrix<float, 4, 4>::Scale({ 1.0f + i * 0.1f, 2.0f, 0.5f }) * Matrix<float, 4, 4>::RotationX(i * 0.2f);
+			}
+
+			BatchMath::TransformPoints(matrix, xs, ys, zs, outputXs, outputYs, outputZs);
+			BatchMath::MultiplyMatrices(first, second, products);
+
+			Bounds bounds = BatchMath::ComputeBounds(xs, ys, zs);
+
+			Vector<float, 3> minimum = { xs[0], ys[0], zs[0] };
+			Vector<float, 3> maximum = minimum;
+
+			bool passed = true;
+
+			for (size_t i = 0; i < COUNT; ++i)
+			{
+				passed &= Test::Check(Test::IsClose(Vector<float, 3>{ outputXs[i], outputYs[i], outputZs[i] }, matrix.TransformPoint({ xs[i], ys[i], zs[i] })), std::format("{} point transform {}", BatchMath::GetBackendName(), i));
+				passed &= Test::Check(Test::IsClose(products[i], first[i] * second[i]), std::format("{} matrix product {}", BatchMath::GetBackendName(), i));
+
+				minimum = { std::min(minimum.x(), xs[i]), std::min(minimum.y(), ys[i]), std::min(minimum.z(), zs[i]) };
+				maximum = { std::max(maximum.x(), xs[i]), std::max(maximum.y(), ys[i]), std::max(maximum.z(), zs[i]) };
+			}
+
+			passed &= Test::Check(bounds.minimum == minimum && bounds.maximum == maximum, std::format("{} bounds", BatchMath::GetBackendName()));
+
+			BatchMath::NormalizeMany(xs, ys, zs);
+
+			for (size_t i = 0; i < COUNT; ++i)
+				passed &= Test::Check(Test::IsClose(Vector<float, 3>{ xs[i], ys[i], zs[i] }, Vector<float, 3>::Normalize({ GetX(i), GetY(i), GetZ(i) })), std::format("{} normalize {}", BatchMath::GetBackendName(), i));
+
+			return passed;
+		}
+
+	private:
+
+		static constexpr size_t COUNT = 19;
+
+		BatchMathTest() = default;
+
+		static float GetX(size_t i)
+		{
+			return std::sin(i * 0.7f) * 4.0f;
+		}
+
+		static float GetY(size_t i)
+		{
+			return std::cos(i * 1.3f) * 2.0f - 1.0f;
+		}
+
+		static float GetZ(size_t i)
+		{
+			return static_cast<float>(i) * 0.25f - 2.0f;
+		}
+
+	};
+}
\ No newline at end of file
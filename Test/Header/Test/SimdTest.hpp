@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+#include "Test/Test.hpp"
+
+using namespace Wasteland::Math;
+
+namespace Wasteland::Test
+{
+	class SimdTest final
+	{
+
+	public:
+
+		SimdTest(const SimdTest&) = delete;
+		SimdTest(SimdTest&&) = delete;
+		SimdTest& operator=(const SimdTest&) = delete;
+		SimdTest& operator=(SimdTest&&) = delete;
+
+		static bool Run()
+		{
+			constexpr Matrix<float, 4, 4> first = Matrix<float, 4, 4>::TranslationRotationScale({ 1.0f, -2.0f, 3.5f }, { 0.18257419f, 0.36514837f, 0.54772256f, 0.73029674f }, { 2.0f, 0.5f, 1.5f });
+			constexpr Matrix<float, 4, 4> second = Matrix<float, 4, 4>::Perspective(1.2f, 1.6f, 0.1f, 100.0f) * Matrix<float, 4, 4>::LookAt({ 3.0f, 4.0f, 5.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+			constexpr Matrix<float, 4, 4> general = Matrix<float, 4, 4>({ 4.0f, 1.0f, -2.0f, 0.5f }, { 3.0f, -6.0f, 1.0f, 2.0f }, { -1.0f, 2.0f, 5.0f, -3.0f }, { 2.0f, 0.0f, 1.0f, 7.0f });
+
+			constexpr Vector<float, 4> vector = { 0.5f, -1.5f, 2.25f, 1.0f };
+			constexpr Vector<float, 4> other = { -3.0f, 0.75f, 4.0f, 2.5f };
+
+			constexpr Matrix<float, 4, 4> expectedProduct = first * second;
+			constexpr Matrix<float, 4, 4> expectedTranspose = Matrix<float, 4, 4>::Transpose(general);
+			constexpr Matrix<float, 4, 4> expectedInverse = Matrix<float, 4, 4>::Inverse(general);
+			constexpr Matrix<float, 4, 4> expectedInverseTransform = Matrix<float, 4, 4>::Inverse(first);
+
+			constexpr Vector<float, 4> expectedTransform = second * vector;
+			constexpr Vector<float, 3> expectedPoint = first.TransformPoint({ 0.5f, -1.5f, 2.25f });
+			constexpr Vector<float, 3> expectedDirection = first.TransformDirection({ 0.5f, -1.5f, 2.25f });
+
+			constexpr Vector<float, 4> expectedSum = vector + other;
+			constexpr Vector<float, 4> expectedDifference = vector - other;
+			constexpr Vector<float, 4> expectedProductVector = vector * other;
+			constexpr Vector<float, 4> expectedQuotient = vector / other;
+			constexpr Vector<float, 4> expectedNormalized = Vector<float, 4>::Normalize(vector);
+			constexpr float expectedDot = Vector<float, 4>::Dot(vector, other);
+
+			bool passed = true;
+
+			passed &= Test::Check(Test::IsClose(first * second, expectedProduct), "matrix product");
+			passed &= Test::Check(Test::IsClose(Matrix<float, 4, 4>::Transpose(general), expectedTranspose), "matrix transpose");
+			passed &= Test::Check(Test::IsClose(Matrix<float, 4, 4>::Inverse(general), expectedInverse), "general matrix inverse");
+			passed &= Test::Check(Test::IsClose(Matrix<float, 4, 4>::Inverse(first), expectedInverseTransform), "transform matrix inverse");
+			passed &= Test::Check(Test::IsClose(second * vector, expectedTransform), "matrix-vector product");
+			passed &= Test::Check(Test::IsClose(first.TransformPoint({ 0.5f, -1.5f, 2.25f }), expectedPoint), "point transform");
+			passed &= Test::Check(Test::IsClose(first.TransformDirection({ 0.5f, -1.5f, 2.25f }), expectedDirection), "direction transform");
+			passed &= Test::Check(Test::IsClose(vector + other, expectedSum), "vector sum");
+			passed &= Test::Check(Test::IsClose(vector - other, expectedDifference), "vector difference");
+			passed &= Test::Check(Test::IsClose(vector * other, expectedProductVector), "vector product");
+			passed &= Test::Check(Test::IsClose(vector / other, expectedQuotient), "vector quotient");
+			passed &= Test::Check(Test::IsClose(Vector<float, 4>::Normalize(vector), expectedNormalized), "vector normalize");
+			passed &= Test::Check(Test::IsClose(Vector<float, 4>::Dot(vector, other), expectedDot), "vector dot");
+
+			return passed;
+		}
+
+	private:
+
+		SimdTest() = default;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <string_view>
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+using namespace Wasteland::Math;
+
+namespace Wasteland::Test
+{
+	class Test final
+	{
+
+	public:
+
+		Test(const Test&) = delete;
+		Test(Test&&) = delete;
+		Test& operator=(const Test&) = delete;
+		Test& operator=(Test&&) = delete;
+
+		static bool Check(bool condition, std::string_view description)
+		{
+			if (!condition)
+				std::cout << std::format("   failed: {}", description) << std::endl;
+
+			return condition;
+		}
+
+		static bool IsClose(float value, float expected)
+		{
+			return std::abs(value - expected) <= TOLERANCE * std::max(1.0f, std::abs(expected));
+		}
+
+		template <size_t N>
+		static bool IsClose(const Vector<float, N>& value, const Vector<float, N>& expected)
+		{
+			for (size_t i = 0; i < N; ++i)
+			{
+				if (!IsClose(value[i], expected[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+		static bool IsClose(const Matrix<float, 4, 4>& value, const Matrix<float, 4, 4>& expected)
+		{
+			for (size_t c = 0; c < 4; ++c)
+			{
+				for (size_t r = 0; r < 4; ++r)
+				{
+					if (!IsClose(value[c][r], expected[c][r]))
+						return false;
+				}
+			}
+
+			return true;
+		}
+
+	private:
+
+		static constexpr float TOLERANCE = 1e-5f;
+
+		Test() = default;
+
+	};
+}
\ No newline at end of file
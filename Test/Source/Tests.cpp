@@ -0,0 +1,45 @@
+#include <format>
+#include <iostream>
+#include <string_view>
+#include "Test/BatchMathTest.hpp"
+#include "Test/SimdTest.hpp"
+
+using namespace Wasteland::Test;
+
+struct TestEntry
+{
+	std::string_view name;
+
+	bool (*run)();
+};
+
+static constexpr TestEntry TESTS[] =
+{
+	{ "simd", &SimdTest::Run },
+	{ "batch", &BatchMathTest::Run }
+};
+
+int main(int argc, char** argv)
+{
+	size_t failures = 0;
+
+	for (const TestEntry& test : TESTS)
+	{
+		bool isSelected = argc <= 1;
+
+		for (int i = 1; i < argc; ++i)
+			isSelected |= std::string_view(argv[i]) == test.name;
+
+		if (!isSelected)
+			continue;
+
+		bool passed = test.run();
+
+		std::cout << std::format("{} {}", passed ? "PASS" : "FAIL", test.name) << std::endl;
+
+		if (!passed)
+			++failures;
+	}
+
+	return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
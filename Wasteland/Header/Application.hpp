@@ -7,11 +7,17 @@
 #include "Entity/Entities/EntityPlayer.hpp"
 #include "Math/Matrix.hpp"
 #include "Render/Mesh.hpp"
+#include "Render/RenderThread.hpp"
+#include "Render/UploadThread.hpp"
 #include "Render/ShaderManager.hpp"
 #include "Render/TextureManager.hpp"
 #include "Utility/Time.hpp"
 #include "World/WorldBase.hpp"
 
+#if defined(WASTELAND_PROFILING)
+	#include "Utility/AllocationCounter.hpp"
+#endif
+
 using namespace Wasteland::Core;
 using namespace Wasteland::ECS;
 using namespace Wasteland::Entity;
@@ -29,13 +35,20 @@ namespace Wasteland
 
 		void PreInitialize()
 		{
+			MainThreadExecutor::GetInstance().BindToCurrentThread();
+
 			Window::GetInstance().Initialize("Wasteland* 9.2.3-alpha", { 750, 450 });
 
 			InputManager::GetInstance().Initialize();
 
+			UploadThread::GetInstance().Start();
+
 			ShaderManager::GetInstance().Register(Shader::Create("default", { "Wasteland", "Shader/Default" }));
-			TextureManager::GetInstance().Register(Texture::Create("debug", { "Wasteland", "Texture/Debug.png" }));
-			TextureManager::GetInstance().Register(Texture::Create("grass", { "Wasteland", "Texture/Grass.png" }));
+			auto debugTexture = Texture::Load("debug", { "Wasteland", "Texture/Debug.png" });
+			auto grassTexture = Texture::Load("grass", { "Wasteland", "Texture/Grass.png" });
+
+			TextureManager::GetInstance().Register(SyncWait(debugTexture));
+			TextureManager::GetInstance().Register(SyncWait(grassTexture));
 		}
 
 		void Initialize()
@@ -53,6 +66,9 @@ namespace Wasteland
 			playerObject.lock()->GetComponent<Rigidbody<btCapsuleShape>>().value()->SetRotationConstraints({ false, false, false });
 			
 			playerObject.lock()->GetTransform()->SetLocalPosition({ 10.0f, 20.0f, 10.0f });
+
+			if (frameMode == FrameMode::PIPELINED)
+				RenderThread::GetInstance().Start();
 		}
 
 		void Update()
@@ -68,19 +84,45 @@ namespace Wasteland
 
 		void Render()
 		{
-			Window::GetInstance().Clear();
+			auto camera = playerObject.lock()->GetComponent<EntityPlayer>().value()->GetCamera();
 
-			GameObjectManager::GetInstance().Render(playerObject.lock()->GetComponent<EntityPlayer>().value()->GetCamera());
+			camera->UpdateData();
+
+			snapshot.Clear();
+			snapshot.SetCamera(*camera);
+			snapshot.viewport = Window::GetInstance().GetFramebufferDimensions();
+			snapshot.inputTime = lastInputTime;
+			snapshot.time = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+
+			GameObjectManager::GetInstance().Render(snapshot);
 
 			MainThreadExecutor::GetInstance().Execute();
 
+			RenderThread::GetInstance().Submit(snapshot);
+
+			Window::GetInstance().PollEvents();
+
 			InputManager::GetInstance().Update();
 
-			Window::GetInstance().Present();
+			lastInputTime = std::chrono::steady_clock::now();
+
+#if defined(WASTELAND_PROFILING)
+			ReportFrameStatistics();
+#endif
 		}
 
 		void Uninitialize()
 		{
+			RenderThread::GetInstance().Stop();
+
+			snapshot.Clear();
+
+			UniformBuffers::GetInstance().Uninitialize();
+
+			JobSystem::GetInstance().Uninitialize();
+
+			UploadThread::GetInstance().Stop();
+
 			GameObjectManager::GetInstance().Uninitialize();
 
 			PhysicsGlobal::GetInstance().Uninitialize();
@@ -93,6 +135,11 @@ namespace Wasteland
 			return Window::GetInstance().IsRunning();
 		}
 
+		void SetFrameMode(FrameMode mode)
+		{
+			frameMode = mode;
+		}
+
 		static Application& GetInstance()
 		{
 			std::call_once(initializationFlag, [&]()
@@ -105,9 +152,57 @@ namespace Wasteland
 
 	private:
 
+#if defined(WASTELAND_PROFILING)
+		void ReportFrameStatistics()
+		{
+			auto now = std::chrono::steady_clock::now();
+
+			if (now - lastReportTime < std::chrono::seconds(1))
+				return;
+
+			lastReportTime = now;
+
+			FrameStatistics statistics = RenderThread::GetInstance().GetStatistics();
+			ObjectPoolStatistics poolStatistics = ObjectPoolCounters::GetStatistics();
+			SystemSchedulerStatistics schedulerStatistics = SystemScheduler::GetInstance().GetStatistics();
+
+			size_t frames = std::max<size_t>(statistics.presentedFrames - lastPresentedFrames, 1);
+
+			float pooledAllocations = static_cast<float>(poolStatistics.pooledAllocations - lastPoolStatistics.pooledAllocations) / frames;
+			float slabAllocations = static_cast<float>(poolStatistics.heapAllocations - lastPoolStatistics.heapAllocations) / frames;
+
+			size_t allocations = AllocationCounter::GetAllocations();
+
+			float globalAllocations = static_cast<float>(allocations - lastAllocations) / frames;
+
+			lastPresentedFrames = statistics.presentedFrames;
+			lastPoolStatistics = poolStatistics;
+			lastAllocations = allocations;
+
+			std::cout << std::format("Frame ({}): {:.2f} ms frame time, {:.2f} ms input latency", frameMode == FrameMode::PIPELINED ? "pipelined" : "sequential", statistics.frameTime.count(), statistics.inputLatency.count()) << std::endl;
+			std::cout << std::format("Systems ({}): {} systems in {} batches, {:.2f} ms", SystemScheduler::GetInstance().GetExecutionMode() == SystemExecutionMode::PARALLEL ? "parallel" : "sequential", schedulerStatistics.systemCount, schedulerStatistics.batchCount, schedulerStatistics.timeSpent.count()) << std::endl;
+			std::cout << std::format("Allocations: {:.2f} global operator new calls, {:.2f} pooled, {:.2f} pool slab refills per frame", globalAllocations, pooledAllocations, slabAllocations) << std::endl;
+		}
+#endif
+
 		std::weak_ptr<GameObject> playerObject;
 		std::weak_ptr<GameObject> worldObject;
 
+		FrameMode frameMode = FrameMode::SEQUENTIAL;
+
+		RenderSnapshot snapshot;
+
+		std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		std::chrono::steady_clock::time_point lastInputTime = std::chrono::steady_clock::now();
+
+#if defined(WASTELAND_PROFILING)
+		std::chrono::steady_clock::time_point lastReportTime = std::chrono::steady_clock::now();
+
+		size_t lastPresentedFrames = 0;
+		ObjectPoolStatistics lastPoolStatistics;
+		size_t lastAllocations = 0;
+#endif
+
 		static std::once_flag initializationFlag;
 		static std::unique_ptr<Application> instance;
 
@@ -19,6 +19,8 @@ namespace Wasteland::Collider
     
     public:
 
+        using LookupBase = ColliderBase<T>;
+
         virtual T* GetColliderShape() = 0;
 
     };
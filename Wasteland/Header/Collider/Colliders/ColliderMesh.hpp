@@ -2,6 +2,7 @@
 
 #include "Collider/ColliderBase.hpp"
 #include "ECS/GameObject.hpp"
+#include "ECS/ObjectPool.hpp"
 #include "Render/Vertex.hpp"
 
 using namespace Wasteland::Collider;
@@ -9,7 +10,7 @@ using namespace Wasteland::Render;
 
 namespace Wasteland::Collider::Colliders
 {
-    class ColliderMesh final : public ColliderBase<btBvhTriangleMeshShape>
+    class ColliderMesh final : public ColliderBase<btBvhTriangleMeshShape>, public Pooled<ColliderMesh>
     {
 
     public:
@@ -22,6 +23,12 @@ namespace Wasteland::Collider::Colliders
         }
 
         void Initialize() override
+        {
+            if (!shape)
+                Build();
+        }
+
+        void Build()
         {
             btTriangleMesh* triMesh = new btTriangleMesh();
 
@@ -63,7 +70,7 @@ namespace Wasteland::Collider::Colliders
 
         static std::shared_ptr<ColliderMesh> Create(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
         {
-            std::shared_ptr<ColliderMesh> result(new ColliderMesh());
+            std::shared_ptr<ColliderMesh> result = MakePooledShared(new ColliderMesh());
 
             result->vertices = vertices;
             result->indices = indices;
@@ -75,7 +82,7 @@ namespace Wasteland::Collider::Colliders
 
         ColliderMesh() = default;
 
-        btBvhTriangleMeshShape* shape;
+        btBvhTriangleMeshShape* shape = nullptr;
 
         std::vector<Vertex> vertices;
         std::vector<unsigned int> indices;
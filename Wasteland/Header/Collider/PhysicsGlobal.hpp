@@ -1,7 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
 #include <btBulletDynamicsCommon.h>
+#include "Math/Vector.hpp"
+
+using namespace Wasteland::Math;
 
 namespace Wasteland::Collider
 {
@@ -20,6 +26,85 @@ namespace Wasteland::Collider
             return worldHandle;
         }
 
+        void MarkColumnResident(const Vector<int, 2>& column)
+        {
+            std::unique_lock<std::shared_mutex> lock(columnsMutex);
+
+            residentColumns.insert(column);
+        }
+
+        void UnmarkColumnResident(const Vector<int, 2>& column)
+        {
+            std::unique_lock<std::shared_mutex> lock(columnsMutex);
+
+            residentColumns.erase(column);
+        }
+
+        bool IsColumnResident(const Vector<int, 2>& column) const
+        {
+            std::shared_lock<std::shared_mutex> lock(columnsMutex);
+
+            return residentColumns.contains(column);
+        }
+
+        size_t GetResidentColumnCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(columnsMutex);
+
+            return residentColumns.size();
+        }
+
+        void AddBody(btRigidBody* body, short group, short mask, bool isDynamic)
+        {
+            std::lock_guard<std::mutex> lock(worldMutex);
+
+            worldHandle->addRigidBody(body, group, mask);
+
+            if (isDynamic)
+                ++activeBodyCount;
+        }
+
+        void RemoveBody(btRigidBody* body, bool isDynamic, bool isParked)
+        {
+            std::lock_guard<std::mutex> lock(worldMutex);
+
+            if (!isParked)
+                worldHandle->removeRigidBody(body);
+
+            if (isDynamic)
+                --(isParked ? parkedBodyCount : activeBodyCount);
+        }
+
+        void ParkBody(btRigidBody* body)
+        {
+            std::lock_guard<std::mutex> lock(worldMutex);
+
+            worldHandle->removeRigidBody(body);
+
+            --activeBodyCount;
+            ++parkedBodyCount;
+        }
+
+        void UnparkBody(btRigidBody* body, short group, short mask)
+        {
+            std::lock_guard<std::mutex> lock(worldMutex);
+
+            worldHandle->addRigidBody(body, group, mask);
+
+            --parkedBodyCount;
+            ++activeBodyCount;
+        }
+
+        size_t GetActiveBodyCount() const
+        {
+            return activeBodyCount.load(std::memory_order_relaxed);
+        }
+
+        size_t GetParkedBodyCount() const
+        {
+            return parkedBodyCount.load(std::memory_order_relaxed);
+        }
+
         void Uninitialize()
         {
             delete worldHandle;
@@ -54,6 +139,15 @@ namespace Wasteland::Collider
 
         btDiscreteDynamicsWorld* worldHandle;
 
+        std::mutex worldMutex;
+
+        mutable std::shared_mutex columnsMutex;
+
+        std::unordered_set<Vector<int, 2>> residentColumns;
+
+        std::atomic<size_t> activeBodyCount = 0;
+        std::atomic<size_t> parkedBodyCount = 0;
+
         static std::once_flag initializationFlag;
         static std::unique_ptr<PhysicsGlobal> instance;
 
@@ -40,8 +40,6 @@ namespace Wasteland::Core
 
 			glfwMakeContextCurrent(handle);
 
-			glfwSetFramebufferSizeCallback(handle, [](GLFWwindow*, int width, int height) { glViewport(0, 0, width, height); });
-
 			if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
 				throw MAKE_EXCEPTION(IllegalStateException, "Failed to initialize GLAD!");
 
@@ -67,6 +65,43 @@ namespace Wasteland::Core
 			glfwSwapBuffers(handle);
 		}
 
+		void PollEvents()
+		{
+			glfwPollEvents();
+		}
+
+		void SwapBuffers()
+		{
+			glfwSwapBuffers(handle);
+		}
+
+		GLFWwindow* CreateSharedContext()
+		{
+			glfwWindowHint(GLFW_VISIBLE, false);
+
+			GLFWwindow* context = glfwCreateWindow(1, 1, "", nullptr, handle);
+
+			if (!context)
+				throw MAKE_EXCEPTION(InvalidHandleException, "Failed to create shared GLFW context!");
+
+			return context;
+		}
+
+		void DestroySharedContext(GLFWwindow* context)
+		{
+			glfwDestroyWindow(context);
+		}
+
+		void AcquireContext()
+		{
+			glfwMakeContextCurrent(handle);
+		}
+
+		void ReleaseContext()
+		{
+			glfwMakeContextCurrent(nullptr);
+		}
+
 		std::string GetTitle() const
 		{
 			return glfwGetWindowTitle(handle);
@@ -91,6 +126,15 @@ namespace Wasteland::Core
 			glfwSetWindowSize(handle, dimensions.x(), dimensions.y());
 		}
 
+		Vector<int, 2> GetFramebufferDimensions() const
+		{
+			int width, height;
+
+			glfwGetFramebufferSize(handle, &width, &height);
+
+			return { width, height };
+		}
+
 		Vector<int, 2> GetPosition() const
 		{
 			int x, y;
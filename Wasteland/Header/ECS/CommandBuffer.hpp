@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "ECS/EntityHandle.hpp"
+
+namespace Wasteland::ECS
+{
+	class GameObject;
+
+	enum class CommandType
+	{
+		REGISTER,
+		UNREGISTER,
+		ADD_COMPONENT,
+		REMOVE_COMPONENT
+	};
+
+	struct Command
+	{
+		CommandType type;
+
+		EntityHandle entity;
+
+		uint64_t sequence = 0;
+
+		std::shared_ptr<GameObject> object;
+
+		std::function<void(GameObject&)> apply;
+
+		Command* next = nullptr;
+	};
+
+	class CommandBuffer final
+	{
+
+	public:
+
+		CommandBuffer() = default;
+
+		CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer(CommandBuffer&&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(CommandBuffer&&) = delete;
+
+		~CommandBuffer()
+		{
+			Take();
+		}
+
+		void Record(std::unique_ptr<Command> command)
+		{
+			Command* node = command.release();
+
+			node->next = head.load(std::memory_order_relaxed);
+
+			while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		std::vector<std::unique_ptr<Command>> Take()
+		{
+			Command* node = head.exchange(nullptr, std::memory_order_acquire);
+
+			std::vector<std::unique_ptr<Command>> result;
+
+			while (node)
+			{
+				Command* next = node->next;
+
+				result.emplace_back(node);
+
+				node = next;
+			}
+
+			std::reverse(result.begin(), result.end());
+
+			return result;
+		}
+
+	private:
+
+		std::atomic<Command*> head = nullptr;
+
+	};
+}
\ No newline at end of file
@@ -1,22 +1,28 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace Wasteland::Render
 {
-	class Camera;
+	struct RenderSnapshot;
 }
 
 namespace Wasteland::ECS
 {
 	class GameObject;
 
+	class ComponentStorageBase;
+
+	class DependencyBase;
+
 	class Component
 	{
 
 	public:
 
 		using Super = Component;
+		using LookupBase = Component;
 
 		virtual ~Component() = default;
 
@@ -24,7 +30,7 @@ namespace Wasteland::ECS
 
 		virtual void Update() { }
 
-		virtual void Render(std::shared_ptr<Wasteland::Render::Camera>) { }
+		virtual void Render(Wasteland::Render::RenderSnapshot&) { }
 
 		std::shared_ptr<GameObject> GetGameObject() const
 		{
@@ -35,7 +41,12 @@ namespace Wasteland::ECS
 
 		std::weak_ptr<GameObject> gameObject;
 
+		ComponentStorageBase* storage = nullptr;
+
+		std::vector<DependencyBase*> dependencies;
+
 		friend class GameObject;
+		friend class DependencyBase;
 
 	};
 }
\ No newline at end of file
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#include "ECS/EntityHandle.hpp"
+#include "ECS/ObjectPool.hpp"
+
+namespace Wasteland::ECS
+{
+	class Component;
+
+	class ComponentStorageBase
+	{
+
+	public:
+
+		virtual ~ComponentStorageBase() = default;
+
+		virtual void Insert(EntityIndex entity, Component* component) = 0;
+
+		virtual void Remove(EntityIndex entity) = 0;
+
+		virtual void SortBySlot() = 0;
+
+		static void SortAll()
+		{
+			std::lock_guard<std::mutex> lock(registryMutex);
+
+			for (ComponentStorageBase* storage : registry)
+				storage->SortBySlot();
+		}
+
+	protected:
+
+		static void RegisterStorage(ComponentStorageBase* storage)
+		{
+			std::lock_guard<std::mutex> lock(registryMutex);
+
+			registry.push_back(storage);
+		}
+
+	private:
+
+		static std::mutex registryMutex;
+		static std::vector<ComponentStorageBase*> registry;
+
+	};
+
+	std::mutex ComponentStorageBase::registryMutex;
+	std::vector<ComponentStorageBase*> ComponentStorageBase::registry;
+
+	template <typename T>
+	class ComponentStorage final : public ComponentStorageBase
+	{
+
+	public:
+
+		ComponentStorage(const ComponentStorage&) = delete;
+		ComponentStorage(ComponentStorage&&) = delete;
+		ComponentStorage& operator=(const ComponentStorage&) = delete;
+		ComponentStorage& operator=(ComponentStorage&&) = delete;
+
+		void Insert(EntityIndex entity, Component* component) override
+		{
+			Entry entry = MakeEntry(static_cast<T*>(component));
+
+			if (entity >= sparse.size())
+				sparse.resize(entity + 1, NO_ENTITY);
+
+			if (sparse[entity] != NO_ENTITY)
+			{
+				components[sparse[entity]] = entry;
+				isSorted = false;
+
+				return;
+			}
+
+			if (!components.empty() && entry < components.back())
+				isSorted = false;
+
+			sparse[entity] = static_cast<uint32_t>(entities.size());
+
+			entities.push_back(entity);
+			components.push_back(entry);
+		}
+
+		void Remove(EntityIndex entity) override
+		{
+			if (!Contains(entity))
+				return;
+
+			uint32_t index = sparse[entity];
+			uint32_t last = static_cast<uint32_t>(entities.size() - 1);
+
+			if (index != last)
+			{
+				entities[index] = entities[last];
+				components[index] = components[last];
+
+				sparse[entities[index]] = index;
+
+				isSorted = false;
+			}
+
+			entities.pop_back();
+			components.pop_back();
+
+			sparse[entity] = NO_ENTITY;
+		}
+
+		void SortBySlot() override
+		{
+			if constexpr (PoolAllocated<T>)
+			{
+				if (isSorted)
+					return;
+
+				order.resize(entities.size());
+
+				std::iota(order.begin(), order.end(), 0u);
+				std::sort(order.begin(), order.end(), [this](uint32_t left, uint32_t right) { return components[left] < components[right]; });
+
+				sortedEntities.resize(entities.size());
+				sortedComponents.resize(components.size());
+
+				for (uint32_t i = 0; i < order.size(); ++i)
+				{
+					sortedEntities[i] = entities[order[i]];
+					sortedComponents[i] = components[order[i]];
+
+					sparse[sortedEntities[i]] = i;
+				}
+
+				entities.swap(sortedEntities);
+				components.swap(sortedComponents);
+
+				isSorted = true;
+			}
+		}
+
+		bool Contains(EntityIndex entity) const
+		{
+			return entity < sparse.size() && sparse[entity] != NO_ENTITY;
+		}
+
+		T* Get(EntityIndex entity) const
+		{
+			return Contains(entity) ? Resolve(components[sparse[entity]]) : nullptr;
+		}
+
+		T* GetComponent(size_t index) const
+		{
+			return Resolve(components[index]);
+		}
+
+		size_t GetSize() const
+		{
+			return entities.size();
+		}
+
+		const std::vector<EntityIndex>& GetEntities() const
+		{
+			return entities;
+		}
+
+		static ComponentStorage& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<ComponentStorage>(new ComponentStorage());
+
+				RegisterStorage(instance.get());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		using Entry = std::conditional_t<PoolAllocated<T>, uint32_t, T*>;
+
+		ComponentStorage() = default;
+
+		static Entry MakeEntry(T* component)
+		{
+			if constexpr (PoolAllocated<T>)
+				return ObjectPool<T>::GetSlot(component);
+			else
+				return component;
+		}
+
+		static T* Resolve(Entry entry)
+		{
+			if constexpr (PoolAllocated<T>)
+				return ObjectPool<T>::Get(entry);
+			else
+				return entry;
+		}
+
+		std::vector<uint32_t> sparse;
+
+		std::vector<EntityIndex> entities;
+		std::vector<Entry> components;
+
+		bool isSorted = true;
+
+		std::vector<uint32_t> order;
+		std::vector<EntityIndex> sortedEntities;
+		std::vector<Entry> sortedComponents;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<ComponentStorage> instance;
+
+	};
+
+	template <typename T>
+	std::once_flag ComponentStorage<T>::initializationFlag;
+
+	template <typename T>
+	std::unique_ptr<ComponentStorage<T>> ComponentStorage<T>::instance;
+}
\ No newline at end of file
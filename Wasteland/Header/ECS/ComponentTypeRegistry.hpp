@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include "Utility/Exception/Exceptions/IllegalStateException.hpp"
+
+using namespace Wasteland::Utility::Exception::Exceptions;
+
+namespace Wasteland::ECS
+{
+	using ComponentTypeId = uint32_t;
+
+	static constexpr ComponentTypeId MAXIMUM_COMPONENT_TYPES = 64;
+
+	class ComponentTypeRegistry final
+	{
+
+	public:
+
+		ComponentTypeRegistry(const ComponentTypeRegistry&) = delete;
+		ComponentTypeRegistry(ComponentTypeRegistry&&) = delete;
+		ComponentTypeRegistry& operator=(const ComponentTypeRegistry&) = delete;
+		ComponentTypeRegistry& operator=(ComponentTypeRegistry&&) = delete;
+
+		template <typename T>
+		static ComponentTypeId GetTypeId()
+		{
+			static const ComponentTypeId id = AllocateTypeId();
+
+			return id;
+		}
+
+		static ComponentTypeId GetTypeCount()
+		{
+			return nextTypeId.load(std::memory_order_relaxed);
+		}
+
+	private:
+
+		ComponentTypeRegistry() = default;
+
+		static ComponentTypeId AllocateTypeId()
+		{
+			ComponentTypeId id = nextTypeId.fetch_add(1, std::memory_order_relaxed);
+
+			if (id >= MAXIMUM_COMPONENT_TYPES)
+				throw MAKE_EXCEPTION(IllegalStateException, std::format("Exceeded the maximum of {} component types!", MAXIMUM_COMPONENT_TYPES));
+
+			return id;
+		}
+
+		static std::atomic<ComponentTypeId> nextTypeId;
+
+	};
+
+	std::atomic<ComponentTypeId> ComponentTypeRegistry::nextTypeId = 0;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include "ECS/Component.hpp"
+#include "ECS/ComponentTypeRegistry.hpp"
+
+namespace Wasteland::ECS
+{
+	class DependencyBase
+	{
+
+	public:
+
+		DependencyBase(const DependencyBase&) = delete;
+		DependencyBase(DependencyBase&&) = delete;
+		DependencyBase& operator=(const DependencyBase&) = delete;
+		DependencyBase& operator=(DependencyBase&&) = delete;
+
+		bool IsResolved() const
+		{
+			return component != nullptr;
+		}
+
+	protected:
+
+		DependencyBase(Component* owner, ComponentTypeId typeId) : typeId(typeId)
+		{
+			owner->dependencies.push_back(this);
+		}
+
+		std::shared_ptr<Component> component;
+
+	private:
+
+		ComponentTypeId typeId;
+
+		friend class GameObject;
+
+	};
+
+	template <typename T>
+	class Dependency final : public DependencyBase
+	{
+
+	public:
+
+		explicit Dependency(Component* owner) : DependencyBase(owner, ComponentTypeRegistry::GetTypeId<T>()) { }
+
+		T* Get() const
+		{
+			return static_cast<T*>(component.get());
+		}
+
+		std::shared_ptr<T> GetShared() const
+		{
+			return std::static_pointer_cast<T>(component);
+		}
+
+		T* operator->() const
+		{
+			return Get();
+		}
+
+		T& operator*() const
+		{
+			return *Get();
+		}
+
+		explicit operator bool() const
+		{
+			return IsResolved();
+		}
+
+	};
+}
\ No newline at end of file
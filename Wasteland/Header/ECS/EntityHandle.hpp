@@ -0,0 +1,29 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+namespace Wasteland::ECS
+{
+	using EntityIndex = uint32_t;
+
+	static constexpr EntityIndex NO_ENTITY = UINT32_MAX;
+
+	struct EntityHandle
+	{
+		EntityIndex index = NO_ENTITY;
+		uint32_t generation = 0;
+
+		bool IsValid() const
+		{
+			return index != NO_ENTITY;
+		}
+
+		uint64_t GetValue() const
+		{
+			return (static_cast<uint64_t>(generation) << 32) | index;
+		}
+
+		auto operator<=>(const EntityHandle&) const = default;
+	};
+}
\ No newline at end of file
@@ -1,30 +1,47 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bitset>
 #include <concepts>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <mutex>
 #include <format>
-#include <unordered_map>
+#include <utility>
 #include <optional>
-#include <typeindex>
+#include <typeinfo>
+#include <vector>
 #include "ECS/Component.hpp"
+#include "ECS/ComponentStorage.hpp"
+#include "ECS/ComponentTypeRegistry.hpp"
+#include "ECS/Dependency.hpp"
+#include "ECS/EntityHandle.hpp"
+#include "ECS/NameTable.hpp"
+#include "ECS/ObjectPool.hpp"
+#include "ECS/System.hpp"
 #include "Math/Transform.hpp"
+#include "Math/TransformHierarchy.hpp"
+#include "Thread/JobSystem.hpp"
+#include "Utility/Exception/Exceptions/IllegalStateException.hpp"
 #include "Utility/Exception/Exceptions/NoSuchElementException.hpp"
 
 using namespace Wasteland::Math;
+using namespace Wasteland::Thread;
 using namespace Wasteland::Utility::Exception::Exceptions;
 
 namespace Wasteland::ECS
 {
 	template <typename T>
-	concept ComponentType = std::derived_from<T, Component> && std::destructible<T>&& requires(T a, std::shared_ptr<Wasteland::Render::Camera> x)
+	concept ComponentType = std::derived_from<T, Component> && std::destructible<T>&& requires(T a, Wasteland::Render::RenderSnapshot& x)
 	{
 		{ a.Initialize() } -> std::same_as<void>;
 		{ a.Update() } -> std::same_as<void>;
 		{ a.Render(x) } -> std::same_as<void>;
 	};
 
-	class GameObject : public std::enable_shared_from_this<GameObject>
+	class GameObject : public std::enable_shared_from_this<GameObject>, public Pooled<GameObject>
 	{
 
 	public:
@@ -34,47 +51,63 @@ namespace Wasteland::ECS
 		GameObject& operator=(const GameObject&) = delete;
 		GameObject& operator=(GameObject&&) = delete;
 
-		void Update()
+		~GameObject()
 		{
-			std::for_each(componentMap.begin(), componentMap.end(), [&](const auto& pair) { pair.second->Update(); });
+			Detach();
 
-			std::for_each(childrenMap.begin(), childrenMap.end(), [&](const auto& pair) { pair.second->Update(); });
+			for (const auto& component : components)
+				ClearDependencies(*component);
+
+			ReleaseEntity(handle);
 		}
 
-		void Render(std::shared_ptr<Wasteland::Render::Camera> camera)
+		void Render(Wasteland::Render::RenderSnapshot& snapshot)
 		{
-			std::for_each(componentMap.begin(), componentMap.end(), [&](const auto& pair) { pair.second->Render(camera); });
+			std::for_each(components.begin(), components.end(), [&](const auto& component) { component->Render(snapshot); });
 
-			std::for_each(childrenMap.begin(), childrenMap.end(), [&](const auto& pair) { pair.second->Render(camera); });
+			std::for_each(children.begin(), children.end(), [&](const auto& child) { child->Render(snapshot); });
 		}
 
 		template <ComponentType T>
 		std::shared_ptr<T> AddComponent(std::shared_ptr<T> component)
 		{
+			uint8_t slot = componentTable[ComponentTypeRegistry::GetTypeId<T>()];
+
+			if (slot != NO_SLOT)
+				return std::static_pointer_cast<T>(components[slot]);
+
+			if (components.size() >= NO_SLOT)
+				throw MAKE_EXCEPTION(IllegalStateException, std::format("Too many components on GameObject '{}'!", name));
+
 			component->gameObject = shared_from_this();
+			component->storage = &ComponentStorage<T>::GetInstance();
+
+			slot = static_cast<uint8_t>(components.size());
+
+			components.push_back(component);
+			IndexComponent<T>(slot);
+			ResolveDependencies();
+
 			component->Initialize();
 
-			componentMap.insert({ typeid(T), std::move(component) });
+			if constexpr (IsUpdatable<T>)
+				RegisterUpdatableType<T>();
+
+			if (IsAttached())
+				ComponentStorage<T>::GetInstance().Insert(handle.index, components[slot].get());
 
-			return std::static_pointer_cast<T>(componentMap[typeid(T)]);
+			return std::static_pointer_cast<T>(components[slot]);
 		}
 
 		template <ComponentType T>
 		std::optional<std::shared_ptr<T>> GetComponent()
 		{
-			if (componentMap.contains(typeid(T)))
-			{
-				auto found = std::static_pointer_cast<T>(componentMap[typeid(T)]);
-				return std::make_optional(found);
-			}
-			
-			for (auto& [ti, comp] : componentMap)
-			{
-				if (auto casted = std::dynamic_pointer_cast<T>(comp))
-					return std::make_optional(casted);
-			}
+			uint8_t slot = componentTable[ComponentTypeRegistry::GetTypeId<T>()];
 
-			return std::nullopt;
+			if (slot == NO_SLOT)
+				return std::nullopt;
+
+			return std::make_optional(std::static_pointer_cast<T>(components[slot]));
 		}
 
 		std::shared_ptr<Transform> GetTransform()
@@ -85,39 +118,77 @@ namespace Wasteland::ECS
 		template <ComponentType T>
 		bool HasComponent() const
 		{
-			return componentMap.contains(typeid(T));
+			return componentTable[ComponentTypeRegistry::GetTypeId<T>()] != NO_SLOT;
 		}
 
 		template <ComponentType T>
 		void RemoveComponent()
 		{
-			if (!componentMap.contains(typeid(T)))
-				throw MAKE_EXCEPTION(NoSuchElementException, std::format("Component '{}' not found on GameObject '{}'!", typeid(T).name(), name));
+			uint8_t slot = componentTable[ComponentTypeRegistry::GetTypeId<T>()];
+
+			if (slot == NO_SLOT)
+				throw MAKE_EXCEPTION(NoSuchElementException, std::format("Component '{}' not found on GameObject '{}'!", typeid(T).name(), GetName()));
+
+			if (IsAttached())
+				components[slot]->storage->Remove(handle.index);
+
+			std::shared_ptr<Component> removed = std::move(components[slot]);
 
-			componentMap.erase(typeid(T));
+			components.erase(components.begin() + slot);
+
+			for (uint8_t& entry : componentTable)
+			{
+				if (entry == slot)
+					entry = NO_SLOT;
+				else if (entry != NO_SLOT && entry > slot)
+					--entry;
+			}
+
+			ClearDependencies(*removed);
+			ResolveDependencies();
 		}
 
 		std::shared_ptr<GameObject> AddChild(std::shared_ptr<GameObject> child)
 		{
-			std::string name = child->name;
-
 			child->SetParent(shared_from_this());
-			childrenMap.insert({ name, std::move(child) });
+			if (IsAttached())
+				child->Attach();
 
-			return childrenMap[name];
+			return children.emplace_back(std::move(child));
 		}
 
-		std::shared_ptr<GameObject> RemoveChild(const std::string& name)
+		std::shared_ptr<GameObject> RemoveChild(EntityHandle child)
 		{
-			std::shared_ptr<GameObject> result = std::move(childrenMap[name]);
+			auto iterator = std::find_if(children.begin(), children.end(), [&](const auto& candidate) { return candidate->handle == child; });
 
-			result->SetParent(nullptr);
+			if (iterator == children.end())
+				throw MAKE_EXCEPTION(NoSuchElementException, std::format("Child {} not found on GameObject '{}'!", child.GetValue(), GetName()));
 
-			childrenMap.erase(name);
+			std::shared_ptr<GameObject> result = std::move(*iterator);
+
+			children.erase(iterator);
+
+			result->SetParent(nullptr);
+			result->Detach();
 
 			return result;
 		}
 
+		std::optional<std::shared_ptr<GameObject>> FindChild(std::string_view name) const
+		{
+			std::optional<NameId> id = NameTable::GetInstance().Find(name);
+
+			if (!id.has_value())
+				return std::nullopt;
+
+			auto iterator = std::find_if(children.begin(), children.end(), [&](const auto& candidate) { return candidate->name == *id; });
+
+			if (iterator == children.end())
+				return std::nullopt;
+
+			return std::make_optional(*iterator);
+		}
+
 		void SetParent(std::shared_ptr<GameObject> parent)
 		{
 			this->parent = parent == nullptr ? std::nullopt : std::make_optional<std::shared_ptr<GameObject>>(parent);
@@ -125,31 +196,230 @@ namespace Wasteland::ECS
 			GetTransform()->SetParent(parent == nullptr ? nullptr : parent->GetTransform());
 		}
 
-		std::string GetName() const
+		const std::string& GetName() const
+		{
+			return NameTable::GetInstance().Get(name);
+		}
+
+		NameId GetNameId() const
 		{
 			return name;
 		}
 
-		static std::shared_ptr<GameObject> Create(const std::string& name)
+		EntityHandle GetHandle() const
+		{
+			return handle;
+		}
+
+		void Attach()
+		{
+			if (IsAttached())
+				return;
+
+			isAttached = true;
+
+			for (const auto& component : components)
+				component->storage->Insert(handle.index, component.get());
+
+			TransformHierarchy::GetInstance().Register(GetTransform().get(), handle.index);
+
+			for (const auto& child : children)
+				child->Attach();
+		}
+
+		void Detach()
+		{
+			if (!IsAttached())
+				return;
+
+			for (const auto& child : children)
+				child->Detach();
+
+			for (const auto& component : components)
+				component->storage->Remove(handle.index);
+
+			TransformHierarchy::GetInstance().Unregister(GetTransform().get());
+
+			isAttached = false;
+		}
+
+		bool IsAttached() const
+		{
+			return isAttached;
+		}
+
+		EntityIndex GetEntityIndex() const
+		{
+			return handle.index;
+		}
+
+		static bool IsAlive(EntityHandle handle)
+		{
+			std::lock_guard<std::mutex> lock(entityMutex);
+
+			return handle.index < entityGenerations.size() && entityGenerations[handle.index] == handle.generation;
+		}
+
+		static size_t GetUpdatableSystemCount()
 		{
-			std::shared_ptr<GameObject> result(new GameObject());
+			std::lock_guard<std::mutex> lock(updatableTypesMutex);
 
-			result->name = name;
-			result->AddComponent(Transform::Create({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }));
+			return updatableSystems.size();
+		}
+
+		static System GetUpdatableSystem(size_t index)
+		{
+			std::lock_guard<std::mutex> lock(updatableTypesMutex);
+
+			return updatableSystems[index];
+		}
+
+		static std::shared_ptr<GameObject> Create(std::string_view name)
+		{
+			std::shared_ptr<GameObject> result = Create();
+
+			result->name = NameTable::GetInstance().Intern(name);
+
+			return result;
+		}
+
+		static std::shared_ptr<GameObject> Create()
+		{
+			std::shared_ptr<GameObject> result = MakePooledShared(new GameObject());
+
+			result->AddComponent(Transform::Create({ 0.0f, 0.0f, 0.0f }, Quaternion<float>::Identity(), { 1.0f, 1.0f, 1.0f }));
 
 			return result;
 		}
 
 	private:
 
-		GameObject() = default;
+		static constexpr uint8_t NO_SLOT = UINT8_MAX;
+
+		GameObject() : handle(AllocateEntity())
+		{
+			componentTable.fill(NO_SLOT);
+		}
+
+		void ResolveDependencies()
+		{
+			for (const auto& component : components)
+			{
+				for (DependencyBase* dependency : component->dependencies)
+				{
+					uint8_t slot = componentTable[dependency->typeId];
+
+					dependency->component = slot == NO_SLOT ? nullptr : components[slot];
+				}
+			}
+		}
+
+		static void ClearDependencies(Component& component)
+		{
+			for (DependencyBase* dependency : component.dependencies)
+				dependency->component = nullptr;
+		}
+
+		template <typename T>
+		void IndexComponent(uint8_t slot)
+		{
+			uint8_t& entry = componentTable[ComponentTypeRegistry::GetTypeId<T>()];
+
+			if (entry == NO_SLOT)
+				entry = slot;
+
+			if constexpr (!std::is_same_v<typename T::LookupBase, T> && !std::is_same_v<typename T::LookupBase, Component>)
+				IndexComponent<typename T::LookupBase>(slot);
+		}
+
+		template <ComponentType T>
+		static void RegisterUpdatableType()
+		{
+			std::lock_guard<std::mutex> lock(updatableTypesMutex);
+
+			ComponentTypeId typeId = ComponentTypeRegistry::GetTypeId<T>();
+
+			if (updatableTypes.test(typeId))
+				return;
+
+			updatableTypes.set(typeId);
+
+			SystemAccess access = GetComponentSystemAccess<T>();
+
+			updatableSystems.push_back({ std::format("component.{}", typeid(T).name()), access, [grainSize = access.grainSize]()
+			{
+				const auto& storage = ComponentStorage<T>::GetInstance();
+
+				if (grainSize == 0 || storage.GetSize() <= grainSize)
+				{
+					for (size_t i = 0; i < storage.GetSize(); ++i)
+						storage.GetComponent(i)->Update();
+
+					return;
+				}
+
+				JobSystem::GetInstance().ParallelForBatch(0, storage.GetSize(), grainSize, [&storage](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+						storage.GetComponent(i)->Update();
+				});
+			} });
+		}
+
+		static EntityHandle AllocateEntity()
+		{
+			std::lock_guard<std::mutex> lock(entityMutex);
+
+			if (freeEntityIndices.empty())
+			{
+				entityGenerations.push_back(0);
+
+				return { static_cast<EntityIndex>(entityGenerations.size() - 1), 0 };
+			}
 
-		std::string name;
+			EntityIndex index = freeEntityIndices.back();
+
+			freeEntityIndices.pop_back();
+
+			return { index, entityGenerations[index] };
+		}
+
+		static void ReleaseEntity(EntityHandle handle)
+		{
+			std::lock_guard<std::mutex> lock(entityMutex);
+
+			++entityGenerations[handle.index];
+
+			freeEntityIndices.push_back(handle.index);
+		}
+
+		EntityHandle handle;
+
+		NameId name = NO_NAME;
 
 		std::optional<std::weak_ptr<GameObject>> parent;
 
-		std::unordered_map<std::type_index, std::shared_ptr<Component>> componentMap;
-		std::unordered_map<std::string, std::shared_ptr<GameObject>> childrenMap;
+		std::vector<std::shared_ptr<Component>> components;
+		std::array<uint8_t, MAXIMUM_COMPONENT_TYPES> componentTable;
+		std::vector<std::shared_ptr<GameObject>> children;
+
+		bool isAttached = false;
+
+		static std::mutex updatableTypesMutex;
+		static std::bitset<MAXIMUM_COMPONENT_TYPES> updatableTypes;
+		static std::vector<System> updatableSystems;
+
+		static std::mutex entityMutex;
+		static std::vector<EntityIndex> freeEntityIndices;
+		static std::vector<uint32_t> entityGenerations;
 
 	};
+
+	std::mutex GameObject::updatableTypesMutex;
+	std::bitset<MAXIMUM_COMPONENT_TYPES> GameObject::updatableTypes;
+	std::vector<System> GameObject::updatableSystems;
+
+	std::mutex GameObject::entityMutex;
+	std::vector<EntityIndex> GameObject::freeEntityIndices;
+	std::vector<uint32_t> GameObject::entityGenerations;
 }
\ No newline at end of file
@@ -1,26 +1,16 @@
 #pragma once
 
 #include <future>
+#include <optional>
 #include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include "ECS/CommandBuffer.hpp"
 #include "ECS/GameObject.hpp"
+#include "ECS/SystemScheduler.hpp"
 
 namespace Wasteland::ECS
 {
-    enum class ActionType
-    {
-        REGISTER,
-        UNREGISTER
-    };
-
-    struct PendingAction
-    {
-        ActionType type;
-
-        std::string name;
-
-        std::shared_ptr<GameObject> object;
-    };
-
 	class GameObjectManager
 	{
 
@@ -33,48 +23,89 @@ namespace Wasteland::ECS
 
         std::shared_ptr<GameObject> Register(std::shared_ptr<GameObject> gameObject)
         {
-            PendingAction action;
+            Record(CommandType::REGISTER, gameObject->GetHandle(), gameObject);
 
-            action.type = ActionType::REGISTER;
-            action.name = gameObject->GetName();
-            action.object = gameObject;
+            return gameObject;
+        }
 
-            pendingActions.push_back(std::move(action));
+        void Unregister(EntityHandle entity)
+        {
+            Record(CommandType::UNREGISTER, entity, nullptr);
+        }
 
-            return gameObject;
+        std::optional<std::shared_ptr<GameObject>> Get(EntityHandle entity) const
+        {
+            if (entity.index >= gameObjectSlots.size() || gameObjectSlots[entity.index] == NO_SLOT)
+                return std::nullopt;
+
+            const auto& gameObject = gameObjects[gameObjectSlots[entity.index]];
+
+            if (gameObject->GetHandle() != entity)
+                return std::nullopt;
+
+            return std::make_optional(gameObject);
         }
 
-        void Unregister(const std::string& name)
+        std::optional<std::shared_ptr<GameObject>> Find(std::string_view name) const
         {
-            PendingAction action;
+            auto iterator = nameIndex.find(name);
 
-            action.type = ActionType::UNREGISTER;
-            action.name = name;
-            
-            pendingActions.push_back(std::move(action));
+            if (iterator == nameIndex.end())
+                return std::nullopt;
+
+            return Get(iterator->second);
+        }
+
+        template <ComponentType T>
+        void AddComponent(const std::shared_ptr<GameObject>& gameObject, std::shared_ptr<T> component)
+        {
+            Record(CommandType::ADD_COMPONENT, gameObject->GetHandle(), gameObject, [component = std::move(component)](GameObject& target) { target.AddComponent(component); });
+        }
+
+        template <ComponentType T>
+        void RemoveComponent(const std::shared_ptr<GameObject>& gameObject)
+        {
+            Record(CommandType::REMOVE_COMPONENT, gameObject->GetHandle(), gameObject, [](GameObject& target) { target.RemoveComponent<T>(); });
         }
 
         void Update()
         {
-            for (auto& [name, obj] : gameObjectMap)
-                obj->Update();
+            while (registeredSystemCount < GameObject::GetUpdatableSystemCount())
+                SystemScheduler::GetInstance().Register(GameObject::GetUpdatableSystem(registeredSystemCount++));
+
+            ComponentStorageBase::SortAll();
+
+            SystemScheduler::GetInstance().Run();
             
-            ApplyPendingActions();
+            ApplyCommands();
+
+            TransformHierarchy::GetInstance().Update();
         }
 
-        void Render(std::optional<std::shared_ptr<Wasteland::Render::Camera>> camera)
+        void Render(Wasteland::Render::RenderSnapshot& snapshot)
         {
-            if (!camera.has_value())
-                return;
-
-            std::for_each(gameObjectMap.begin(), gameObjectMap.end(), [&](const auto& pair) { pair.second->Render(camera.value()); });
+            std::for_each(gameObjects.begin(), gameObjects.end(), [&](const auto& gameObject) { gameObject->Render(snapshot); });
         }
 
         void Uninitialize()
         {
-            std::for_each(gameObjectMap.begin(), gameObjectMap.end(), [&](auto& pair) { pair.second.reset(); });
+            for (size_t i = 0; i < registeredSystemCount; ++i)
+                SystemScheduler::GetInstance().Unregister(GameObject::GetUpdatableSystem(i).name);
+
+            registeredSystemCount = 0;
+
+            {
+                std::lock_guard<std::mutex> lock(commandBuffersMutex);
+
+                for (auto& buffer : commandBuffers)
+                    buffer->Take();
+            }
+
+            std::for_each(gameObjects.begin(), gameObjects.end(), [&](auto& gameObject) { gameObject->Detach(); gameObject.reset(); });
 
-            gameObjectMap.clear();
+            gameObjects.clear();
+            gameObjectSlots.clear();
+            nameIndex.clear();
         }
 
         static GameObjectManager& GetInstance()
@@ -89,24 +120,131 @@ namespace Wasteland::ECS
 
     private:
 
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
         GameObjectManager() = default;
 
-        void ApplyPendingActions()
+        void Record(CommandType type, EntityHandle entity, std::shared_ptr<GameObject> object, std::function<void(GameObject&)> apply = { })
+        {
+            auto command = std::make_unique<Command>();
+
+            command->type = type;
+            command->entity = entity;
+            command->sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+            command->object = std::move(object);
+            command->apply = std::move(apply);
+
+            GetCommandBuffer().Record(std::move(command));
+        }
+
+        CommandBuffer& GetCommandBuffer()
+        {
+            thread_local CommandBuffer* buffer = nullptr;
+
+            if (!buffer)
+            {
+                std::lock_guard<std::mutex> lock(commandBuffersMutex);
+
+                buffer = commandBuffers.emplace_back(std::make_unique<CommandBuffer>()).get();
+            }
+
+            return *buffer;
+        }
+
+        void ApplyCommands()
+        {
+            std::vector<std::unique_ptr<Command>> commands;
+
+            {
+                std::lock_guard<std::mutex> lock(commandBuffersMutex);
+
+                for (auto& buffer : commandBuffers)
+                {
+                    auto recorded = buffer->Take();
+
+                    std::move(recorded.begin(), recorded.end(), std::back_inserter(commands));
+                }
+            }
+
+            if (commands.empty())
+                return;
+
+            std::sort(commands.begin(), commands.end(), [](const auto& left, const auto& right) { return left->sequence < right->sequence; });
+
+            for (auto& command : commands)
+            {
+                switch (command->type)
+                {
+                    case CommandType::REGISTER:
+                        Insert(std::move(command->object));
+                        break;
+
+                    case CommandType::UNREGISTER:
+                        Erase(command->entity);
+                        break;
+
+                    case CommandType::ADD_COMPONENT:
+                    case CommandType::REMOVE_COMPONENT:
+                        command->apply(*command->object);
+                        break;
+                }
+            }
+        }
+
+        void Insert(std::shared_ptr<GameObject> gameObject)
+        {
+            EntityHandle entity = gameObject->GetHandle();
+
+            if (entity.index >= gameObjectSlots.size())
+                gameObjectSlots.resize(entity.index + 1, NO_SLOT);
+
+            if (gameObjectSlots[entity.index] != NO_SLOT)
+                return;
+
+            gameObjectSlots[entity.index] = static_cast<uint32_t>(gameObjects.size());
+
+            if (gameObject->GetNameId() != NO_NAME)
+                nameIndex.insert({ gameObject->GetName(), entity });
+
+            gameObject->Attach();
+            gameObjects.push_back(std::move(gameObject));
+        }
+
+        void Erase(EntityHandle entity)
         {
-            for (auto& action : pendingActions)
+            if (!Get(entity).has_value())
+                return;
+
+            uint32_t slot = gameObjectSlots[entity.index];
+
+            std::shared_ptr<GameObject> gameObject = std::move(gameObjects[slot]);
+
+            if (slot != gameObjects.size() - 1)
             {
-                if (action.type == ActionType::REGISTER)
-                    gameObjectMap.insert({ action.name, action.object });
-                else if (action.type == ActionType::UNREGISTER)
-                    gameObjectMap.erase(action.name);
+                gameObjects[slot] = std::move(gameObjects.back());
+                gameObjectSlots[gameObjects[slot]->GetHandle().index] = slot;
             }
 
-            pendingActions.clear();
+            gameObjects.pop_back();
+            gameObjectSlots[entity.index] = NO_SLOT;
+
+            if (auto iterator = nameIndex.find(gameObject->GetName()); iterator != nameIndex.end() && iterator->second == entity)
+                nameIndex.erase(iterator);
+
+            gameObject->Detach();
         }
 
-        std::unordered_map<std::string, std::shared_ptr<GameObject>> gameObjectMap;
+        std::vector<std::shared_ptr<GameObject>> gameObjects;
+        std::vector<uint32_t> gameObjectSlots;
+
+        std::unordered_map<std::string_view, EntityHandle> nameIndex;
+
+        std::mutex commandBuffersMutex;
+        std::vector<std::unique_ptr<CommandBuffer>> commandBuffers;
+
+        std::atomic<uint64_t> nextSequence = 0;
 
-        std::vector<PendingAction> pendingActions;
+        size_t registeredSystemCount = 0;
 
         static std::once_flag initializationFlag;
         static std::unique_ptr<GameObjectManager> instance;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Wasteland::ECS
+{
+	using NameId = uint32_t;
+
+	static constexpr NameId NO_NAME = UINT32_MAX;
+
+	class NameTable final
+	{
+
+	public:
+
+		NameTable(const NameTable&) = delete;
+		NameTable(NameTable&&) = delete;
+		NameTable& operator=(const NameTable&) = delete;
+		NameTable& operator=(NameTable&&) = delete;
+
+		NameId Intern(std::string_view name)
+		{
+			{
+				std::shared_lock<std::shared_mutex> lock(mutex);
+
+				if (auto iterator = nameMap.find(name); iterator != nameMap.end())
+					return iterator->second;
+			}
+
+			std::unique_lock<std::shared_mutex> lock(mutex);
+
+			if (auto iterator = nameMap.find(name); iterator != nameMap.end())
+				return iterator->second;
+
+			NameId id = static_cast<NameId>(names.size());
+
+			nameMap.insert({ names.emplace_back(name), id });
+
+			return id;
+		}
+
+		std::optional<NameId> Find(std::string_view name) const
+		{
+			std::shared_lock<std::shared_mutex> lock(mutex);
+
+			if (auto iterator = nameMap.find(name); iterator != nameMap.end())
+				return std::make_optional(iterator->second);
+
+			return std::nullopt;
+		}
+
+		const std::string& Get(NameId id) const
+		{
+			static const std::string EMPTY_NAME;
+
+			if (id == NO_NAME)
+				return EMPTY_NAME;
+
+			std::shared_lock<std::shared_mutex> lock(mutex);
+
+			return names[id];
+		}
+
+		static NameTable& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<NameTable>(new NameTable());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		NameTable() = default;
+
+		mutable std::shared_mutex mutex;
+
+		std::deque<std::string> names;
+		std::unordered_map<std::string_view, NameId> nameMap;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<NameTable> instance;
+
+	};
+
+	std::once_flag NameTable::initializationFlag;
+	std::unique_ptr<NameTable> NameTable::instance;
+}
\ No newline at end of file
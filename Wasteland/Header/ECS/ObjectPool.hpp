@@ -0,0 +1,219 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace Wasteland::ECS
+{
+	struct ObjectPoolStatistics
+	{
+		size_t pooledAllocations = 0;
+		size_t heapAllocations = 0;
+	};
+
+	class ObjectPoolCounters final
+	{
+
+	public:
+
+		ObjectPoolCounters(const ObjectPoolCounters&) = delete;
+		ObjectPoolCounters(ObjectPoolCounters&&) = delete;
+		ObjectPoolCounters& operator=(const ObjectPoolCounters&) = delete;
+		ObjectPoolCounters& operator=(ObjectPoolCounters&&) = delete;
+
+		static ObjectPoolStatistics GetStatistics()
+		{
+			return { pooledAllocations.load(std::memory_order_relaxed), heapAllocations.load(std::memory_order_relaxed) };
+		}
+
+	private:
+
+		ObjectPoolCounters() = default;
+
+		static std::atomic<size_t> pooledAllocations;
+		static std::atomic<size_t> heapAllocations;
+
+		template <typename T>
+		friend class ObjectPool;
+
+	};
+
+	std::atomic<size_t> ObjectPoolCounters::pooledAllocations = 0;
+	std::atomic<size_t> ObjectPoolCounters::heapAllocations = 0;
+
+	template <typename T>
+	class ObjectPool final
+	{
+
+	public:
+
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool(ObjectPool&&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+		ObjectPool& operator=(ObjectPool&&) = delete;
+
+		static void* Allocate()
+		{
+			State& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.mutex);
+
+			if (!state.freeHead)
+				Grow(state);
+
+			Block* block = state.freeHead;
+
+			state.freeHead = block->next;
+
+			ObjectPoolCounters::pooledAllocations.fetch_add(1, std::memory_order_relaxed);
+
+			return block->storage;
+		}
+
+		static void Deallocate(void* pointer)
+		{
+			Block* block = reinterpret_cast<Block*>(pointer);
+
+			State& state = GetState();
+
+			std::lock_guard<std::mutex> lock(state.mutex);
+
+			block->next = state.freeHead;
+			state.freeHead = block;
+		}
+
+		static uint32_t GetSlot(const void* pointer)
+		{
+			return reinterpret_cast<const Block*>(pointer)->slot;
+		}
+
+		static T* Get(uint32_t slot)
+		{
+			Block* slab = GetState().slabs[slot / BLOCKS_PER_SLAB].load(std::memory_order_acquire);
+
+			return std::launder(reinterpret_cast<T*>(slab[slot % BLOCKS_PER_SLAB].storage));
+		}
+
+	private:
+
+		static constexpr size_t BLOCKS_PER_SLAB = 64;
+		static constexpr size_t MAXIMUM_SLABS = 16384;
+
+		struct Block
+		{
+			union
+			{
+				Block* next;
+				alignas(T) std::byte storage[sizeof(T)];
+			};
+
+			uint32_t slot;
+		};
+
+		struct State
+		{
+			std::mutex mutex;
+			std::array<std::atomic<Block*>, MAXIMUM_SLABS> slabs = { };
+			size_t slabCount = 0;
+			Block* freeHead = nullptr;
+		};
+
+		ObjectPool() = default;
+
+		static void Grow(State& state)
+		{
+			if (state.slabCount >= MAXIMUM_SLABS)
+				throw std::bad_alloc();
+
+			Block* slab = new Block[BLOCKS_PER_SLAB];
+
+			for (size_t i = 0; i < BLOCKS_PER_SLAB; ++i)
+				slab[i].slot = static_cast<uint32_t>(state.slabCount * BLOCKS_PER_SLAB + i);
+
+			state.slabs[state.slabCount++].store(slab, std::memory_order_release);
+
+			for (size_t i = 0; i < BLOCKS_PER_SLAB - 1; ++i)
+				slab[i].next = &slab[i + 1];
+
+			slab[BLOCKS_PER_SLAB - 1].next = state.freeHead;
+			state.freeHead = slab;
+
+			ObjectPoolCounters::heapAllocations.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		static State& GetState()
+		{
+			static State* state = new State();
+
+			return *state;
+		}
+
+	};
+
+	template <typename T>
+	class Pooled
+	{
+
+	public:
+
+		static void* operator new(size_t size)
+		{
+			return size == sizeof(T) ? ObjectPool<T>::Allocate() : ::operator new(size);
+		}
+
+		static void operator delete(void* pointer, size_t size)
+		{
+			if (size == sizeof(T))
+				ObjectPool<T>::Deallocate(pointer);
+			else
+				::operator delete(pointer);
+		}
+
+	};
+
+	template <typename T>
+	concept PoolAllocated = std::derived_from<T, Pooled<T>> && std::is_final_v<T>;
+
+	template <typename T>
+	struct PoolAllocator
+	{
+		using value_type = T;
+
+		PoolAllocator() = default;
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U>&) { }
+
+		T* allocate(size_t count)
+		{
+			return count == 1 ? static_cast<T*>(ObjectPool<T>::Allocate()) : std::allocator<T>().allocate(count);
+		}
+
+		void deallocate(T* pointer, size_t count)
+		{
+			if (count == 1)
+				ObjectPool<T>::Deallocate(pointer);
+			else
+				std::allocator<T>().deallocate(pointer, count);
+		}
+
+		template <typename U>
+		bool operator==(const PoolAllocator<U>&) const
+		{
+			return true;
+		}
+	};
+
+	template <typename T>
+	std::shared_ptr<T> MakePooledShared(T* pointer)
+	{
+		return std::shared_ptr<T>(pointer, std::default_delete<T>(), PoolAllocator<T>());
+	}
+}
\ No newline at end of file
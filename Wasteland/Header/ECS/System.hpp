@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace Wasteland::ECS
+{
+	class Component;
+
+	template <typename T>
+	concept MutatesOnRead = T::MUTATES_ON_READ;
+
+	struct SystemAccess
+	{
+		std::vector<std::type_index> reads;
+		std::vector<std::type_index> writes;
+
+		size_t grainSize = 0;
+
+		bool isExclusive = false;
+
+		template <typename... T>
+		SystemAccess& Read()
+		{
+			((MutatesOnRead<T> ? writes : reads).push_back(typeid(T)), ...);
+
+			return *this;
+		}
+
+		template <typename... T>
+		SystemAccess& Write()
+		{
+			(writes.push_back(typeid(T)), ...);
+
+			return *this;
+		}
+
+		SystemAccess& Parallel(size_t grainSize)
+		{
+			this->grainSize = grainSize;
+
+			return *this;
+		}
+
+		bool ConflictsWith(const SystemAccess& other) const
+		{
+			if (isExclusive || other.isExclusive)
+				return true;
+
+			auto overlaps = [](const std::vector<std::type_index>& left, const std::vector<std::type_index>& right)
+			{
+				return std::any_of(left.begin(), left.end(), [&](const std::type_index& type) { return std::find(right.begin(), right.end(), type) != right.end(); });
+			};
+
+			return overlaps(writes, other.writes) || overlaps(writes, other.reads) || overlaps(reads, other.writes);
+		}
+
+		static SystemAccess Exclusive()
+		{
+			SystemAccess result;
+
+			result.isExclusive = true;
+
+			return result;
+		}
+	};
+
+	struct System
+	{
+		std::string name;
+
+		SystemAccess access;
+
+		std::function<void()> function;
+	};
+
+	template <typename T>
+	concept DeclaresSystemAccess = requires
+	{
+		{ T::GetSystemAccess() } -> std::same_as<SystemAccess>;
+	};
+
+	template <typename T>
+	constexpr bool IsUpdatable = !std::is_same_v<decltype(&T::Update), void (Component::*)()>;
+
+	template <typename T>
+	SystemAccess GetComponentSystemAccess()
+	{
+		if constexpr (DeclaresSystemAccess<T>)
+			return T::GetSystemAccess().template Write<T>();
+		else
+			return SystemAccess::Exclusive();
+	}
+}
\ No newline at end of file
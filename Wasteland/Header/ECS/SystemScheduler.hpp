@@ -0,0 +1,169 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ECS/System.hpp"
+#include "Thread/JobSystem.hpp"
+
+using namespace Wasteland::Thread;
+
+namespace Wasteland::ECS
+{
+	enum class SystemExecutionMode
+	{
+		PARALLEL,
+		SEQUENTIAL
+	};
+
+	struct SystemSchedulerStatistics
+	{
+		size_t systemCount = 0;
+		size_t batchCount = 0;
+
+		std::chrono::duration<float, std::milli> timeSpent = { };
+	};
+
+	class SystemScheduler final
+	{
+
+	public:
+
+		SystemScheduler(const SystemScheduler&) = delete;
+		SystemScheduler(SystemScheduler&&) = delete;
+		SystemScheduler& operator=(const SystemScheduler&) = delete;
+		SystemScheduler& operator=(SystemScheduler&&) = delete;
+
+		void Register(System system)
+		{
+			auto existing = std::find_if(systems.begin(), systems.end(), [&](const System& other) { return other.name == system.name; });
+
+			if (existing != systems.end())
+				*existing = std::move(system);
+			else
+				systems.push_back(std::move(system));
+
+			isDirty = true;
+		}
+
+		void Unregister(const std::string& name)
+		{
+			std::erase_if(systems, [&](const System& system) { return system.name == name; });
+
+			isDirty = true;
+		}
+
+		bool IsRegistered(const std::string& name) const
+		{
+			return std::any_of(systems.begin(), systems.end(), [&](const System& system) { return system.name == name; });
+		}
+
+		void Run()
+		{
+			auto start = std::chrono::steady_clock::now();
+
+			if (isDirty)
+				BuildBatches();
+
+			if (executionMode == SystemExecutionMode::SEQUENTIAL)
+			{
+				for (System& system : systems)
+					system.function();
+			}
+			else
+			{
+				for (const auto& batch : batches)
+				{
+					if (batch.size() == 1)
+					{
+						systems[batch[0]].function();
+						continue;
+					}
+
+					JobSystem::GetInstance().ParallelFor(0, batch.size(), 1, [&](size_t i)
+					{
+						systems[batch[i]].function();
+					});
+				}
+			}
+
+			statistics.systemCount = systems.size();
+			statistics.batchCount = executionMode == SystemExecutionMode::SEQUENTIAL ? systems.size() : batches.size();
+			statistics.timeSpent = std::chrono::steady_clock::now() - start;
+		}
+
+		void SetExecutionMode(SystemExecutionMode mode)
+		{
+			executionMode = mode;
+		}
+
+		SystemExecutionMode GetExecutionMode() const
+		{
+			return executionMode;
+		}
+
+		SystemSchedulerStatistics GetStatistics() const
+		{
+			return statistics;
+		}
+
+		static SystemScheduler& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<SystemScheduler>(new SystemScheduler());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		SystemScheduler() = default;
+
+		void BuildBatches()
+		{
+			batches.clear();
+
+			std::vector<size_t> batchOf(systems.size(), 0);
+
+			for (size_t i = 0; i < systems.size(); ++i)
+			{
+				size_t level = 0;
+
+				for (size_t j = 0; j < i; ++j)
+				{
+					if (systems[i].access.ConflictsWith(systems[j].access))
+						level = std::max(level, batchOf[j] + 1);
+				}
+
+				batchOf[i] = level;
+
+				if (level >= batches.size())
+					batches.resize(level + 1);
+
+				batches[level].push_back(i);
+			}
+
+			isDirty = false;
+		}
+
+		std::vector<System> systems;
+		std::vector<std::vector<size_t>> batches;
+
+		bool isDirty = false;
+
+		SystemExecutionMode executionMode = SystemExecutionMode::PARALLEL;
+
+		SystemSchedulerStatistics statistics;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<SystemScheduler> instance;
+
+	};
+
+	std::once_flag SystemScheduler::initializationFlag;
+	std::unique_ptr<SystemScheduler> SystemScheduler::instance;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "ECS/ComponentStorage.hpp"
+
+namespace Wasteland::ECS
+{
+	template <typename... T>
+	class View final
+	{
+
+	public:
+
+		template <typename F>
+		void ForEach(F&& function) const
+		{
+			if constexpr (sizeof...(T) == 1)
+			{
+				const auto& storage = (ComponentStorage<T>::GetInstance(), ...);
+
+				for (size_t i = 0; i < storage.GetSize(); ++i)
+					function(*storage.GetComponent(i));
+			}
+			else
+			{
+				std::array<const std::vector<EntityIndex>*, sizeof...(T)> candidates = { &ComponentStorage<T>::GetInstance().GetEntities()... };
+
+				const std::vector<EntityIndex>& entities = **std::min_element(candidates.begin(), candidates.end(), [](const auto* left, const auto* right) { return left->size() < right->size(); });
+
+				for (size_t i = 0; i < entities.size(); ++i)
+				{
+					EntityIndex entity = entities[i];
+
+					if ((ComponentStorage<T>::GetInstance().Contains(entity) && ...))
+						function(*ComponentStorage<T>::GetInstance().Get(entity)...);
+				}
+			}
+		}
+
+	};
+}
\ No newline at end of file
@@ -53,7 +53,7 @@ namespace Wasteland::Entity::Entities
 		{
 			if (InputManager::GetInstance().GetKeyState(KeyCode::ESCAPE, KeyState::PRESSED))
 			{
-				MainThreadExecutor::GetInstance().EnqueueTask(this, [&]()
+				MainThreadExecutor::GetInstance().EnqueueTask([&]()
 				{
 					InputManager::GetInstance().SetMouseMode(!InputManager::GetInstance().GetMouseMode());
 				});
@@ -68,6 +68,11 @@ namespace Wasteland::Entity::Entities
 			return camera;
 		}
 
+		static SystemAccess GetSystemAccess()
+		{
+			return SystemAccess().Read<InputManager>().Write<Transform, Rigidbody<btCapsuleShape>>();
+		}
+
 	private:
 
 		void UpdateMouselook()
@@ -76,12 +81,13 @@ namespace Wasteland::Entity::Entities
 			float sensitivity = 0.03f;
 
 			auto transform = camera->GetGameObject()->GetTransform();
-			Vector<float, 3> rotation = transform->GetLocalRotation();
 
-			rotation.y() -= mouseDelta.x() * sensitivity;
-			rotation.x() += mouseDelta.y() * sensitivity;
+			float degreesToRadians = std::numbers::pi_v<float> / 180.0f;
 
-			transform->SetLocalRotation(rotation);
+			Quaternion<float> yaw = Quaternion<float>::AngleAxis(-mouseDelta.x() * sensitivity * degreesToRadians, { 0.0f, 1.0f, 0.0f });
+			Quaternion<float> pitch = Quaternion<float>::AngleAxis(mouseDelta.y() * sensitivity * degreesToRadians, { 1.0f, 0.0f, 0.0f });
+
+			transform->SetLocalRotation(Quaternion<float>::Normalize(yaw * transform->GetLocalRotation() * pitch));
 		}
 
 		void UpdateMovement()
@@ -103,11 +109,13 @@ namespace Wasteland::Entity::Entities
 			if (InputManager::GetInstance().GetKeyState(KeyCode::D, KeyState::HELD))
 				movement -= right * MovementSpeed;
 
-			Super::GetGameObject()->template GetComponent<Rigidbody<btCapsuleShape>>().value()->ApplyCentralForce({ movement.x(), movement.y(), movement.z() });
+			rigidbody->ApplyCentralForce({ movement.x(), movement.y(), movement.z() });
 		}
 
 		std::shared_ptr<Camera> camera;
 
+		Dependency<Rigidbody<btCapsuleShape>> rigidbody{ this };
+
 		BUILDABLE_PROPERTY(MouseSensitivity, float, EntityPlayer)
 
 	};
@@ -0,0 +1,405 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <string_view>
+#include "Math/Matrix.hpp"
+#include "Math/Simd.hpp"
+#include "Math/Vector.hpp"
+
+#if defined(WASTELAND_SIMD_SSE)
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define WASTELAND_TARGET_AVX2
+	#else
+		#define WASTELAND_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#endif
+#endif
+
+namespace Wasteland::Math
+{
+	struct Bounds
+	{
+		Vector<float, 3> minimum;
+		Vector<float, 3> maximum;
+	};
+
+	class BatchMath final
+	{
+
+	public:
+
+		BatchMath(const BatchMath&) = delete;
+		BatchMath(BatchMath&&) = delete;
+		BatchMath& operator=(const BatchMath&) = delete;
+		BatchMath& operator=(BatchMath&&) = delete;
+
+		static void TransformPoints(const Matrix<float, 4, 4>& matrix, std::span<const float> xs, std::span<const float> ys, std::span<const float> zs, std::span<float> outputXs, std::span<float> outputYs, std::span<float> outputZs)
+		{
+			assert(ys.size() == xs.size() && zs.size() == xs.size());
+			assert(outputXs.size() == xs.size() && outputYs.size() == xs.size() && outputZs.size() == xs.size());
+
+			GetKernels().transformPoints(matrix[0].data(), xs.data(), ys.data(), zs.data(), outputXs.data(), outputYs.data(), outputZs.data(), xs.size());
+		}
+
+		static void NormalizeMany(std::span<float> xs, std::span<float> ys, std::span<float> zs)
+		{
+			assert(ys.size() == xs.size() && zs.size() == xs.size());
+
+			GetKernels().normalizeMany(xs.data(), ys.data(), zs.data(), xs.size());
+		}
+
+		static Bounds ComputeBounds(std::span<const float> xs, std::span<const float> ys, std::span<const float> zs)
+		{
+			assert(ys.size() == xs.size() && zs.size() == xs.size());
+
+			float minimum[3];
+			float maximum[3];
+
+			GetKernels().computeBounds(xs.data(), ys.data(), zs.data(), xs.size(), minimum, maximum);
+
+			return { { minimum[0], minimum[1], minimum[2] }, { maximum[0], maximum[1], maximum[2] } };
+		}
+
+		static void MultiplyMatrices(std::span<const Matrix<float, 4, 4>> first, std::span<const Matrix<float, 4, 4>> second, std::span<Matrix<float, 4, 4>> destination)
+		{
+			assert(second.size() == first.size() && destination.size() == first.size());
+
+			static_assert(sizeof(Matrix<float, 4, 4>) == sizeof(float) * 16, "Matrix<float, 4, 4> must be tightly packed");
+
+			GetKernels().multiplyMatrices(first.empty() ? nullptr : first[0][0].data(), second.empty() ? nullptr : second[0][0].data(), destination.empty() ? nullptr : destination[0][0].data(), first.size());
+		}
+
+		static std::string_view GetBackendName()
+		{
+			return GetKernels().name;
+		}
+
+	private:
+
+		struct Kernels
+		{
+			std::string_view name;
+
+			void (*transformPoints)(const float*, const float*, const float*, const float*, float*, float*, float*, size_t);
+			void (*normalizeMany)(float*, float*, float*, size_t);
+			void (*computeBounds)(const float*, const float*, const float*, size_t, float*, float*);
+			void (*multiplyMatrices)(const float*, const float*, float*, size_t);
+		};
+
+		BatchMath() = default;
+
+		static const Kernels& GetKernels()
+		{
+			static const Kernels kernels = SelectKernels();
+
+			return kernels;
+		}
+
+		static Kernels SelectKernels()
+		{
+#if defined(WASTELAND_TARGET_AVX2)
+			if (SupportsAvx2())
+				return { "AVX2", &TransformPointsAvx2, &NormalizeManyAvx2, &ComputeBoundsAvx2, &MultiplyMatricesAvx2 };
+#endif
+
+#if defined(WASTELAND_SIMD_SSE)
+			return { "SSE2", &TransformPoints4, &NormalizeMany4, &ComputeBounds4, &MultiplyMatrices4 };
+#elif defined(WASTELAND_SIMD_NEON)
+			return { "NEON", &TransformPoints4, &NormalizeMany4, &ComputeBounds4, &MultiplyMatrices4 };
+#else
+			return { "Scalar", &TransformPoints4, &NormalizeMany4, &ComputeBounds4, &MultiplyMatrices4 };
+#endif
+		}
+
+		static void TransformPointsScalar(const float* m, const float* xs, const float* ys, const float* zs, float* outputXs, float* outputYs, float* outputZs, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; ++i)
+			{
+				float x = xs[i];
+				float y = ys[i];
+				float z = zs[i];
+
+				outputXs[i] = m[0] * x + m[4] * y + m[8] * z + m[12];
+				outputYs[i] = m[1] * x + m[5] * y + m[9] * z + m[13];
+				outputZs[i] = m[2] * x + m[6] * y + m[10] * z + m[14];
+			}
+		}
+
+		static void NormalizeManyScalar(float* xs, float* ys, float* zs, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; ++i)
+			{
+				float length = std::max(std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i]), std::numeric_limits<float>::min());
+
+				xs[i] /= length;
+				ys[i] /= length;
+				zs[i] /= length;
+			}
+		}
+
+		static void ComputeBoundsScalar(const float* xs, const float* ys, const float* zs, size_t begin, size_t count, float* minimum, float* maximum)
+		{
+			for (size_t i = begin; i < count; ++i)
+			{
+				minimum[0] = std::min(minimum[0], xs[i]);
+				minimum[1] = std::min(minimum[1], ys[i]);
+				minimum[2] = std::min(minimum[2], zs[i]);
+
+				maximum[0] = std::max(maximum[0], xs[i]);
+				maximum[1] = std::max(maximum[1], ys[i]);
+				maximum[2] = std::max(maximum[2], zs[i]);
+			}
+		}
+
+		static void TransformPoints4(const float* m, const float* xs, const float* ys, const float* zs, float* outputXs, float* outputYs, float* outputZs, size_t count)
+		{
+			Simd::Register m00 = Simd::Splat(m[0]), m01 = Simd::Splat(m[4]), m02 = Simd::Splat(m[8]), m03 = Simd::Splat(m[12]);
+			Simd::Register m10 = Simd::Splat(m[1]), m11 = Simd::Splat(m[5]), m12 = Simd::Splat(m[9]), m13 = Simd::Splat(m[13]);
+			Simd::Register m20 = Simd::Splat(m[2]), m21 = Simd::Splat(m[6]), m22 = Simd::Splat(m[10]), m23 = Simd::Splat(m[14]);
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				Simd::Register x = Simd::Load(xs + i);
+				Simd::Register y = Simd::Load(ys + i);
+				Simd::Register z = Simd::Load(zs + i);
+
+				Simd::Store(outputXs + i, Simd::MultiplyAdd(m00, x, Simd::MultiplyAdd(m01, y, Simd::MultiplyAdd(m02, z, m03))));
+				Simd::Store(outputYs + i, Simd::MultiplyAdd(m10, x, Simd::MultiplyAdd(m11, y, Simd::MultiplyAdd(m12, z, m13))));
+				Simd::Store(outputZs + i, Simd::MultiplyAdd(m20, x, Simd::MultiplyAdd(m21, y, Simd::MultiplyAdd(m22, z, m23))));
+			}
+
+			TransformPointsScalar(m, xs, ys, zs, outputXs, outputYs, outputZs, i, count);
+		}
+
+		static void NormalizeMany4(float* xs, float* ys, float* zs, size_t count)
+		{
+			Simd::Register smallest = Simd::Splat(std::numeric_limits<float>::min());
+
+			size_t i = 0;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				Simd::Register x = Simd::Load(xs + i);
+				Simd::Register y = Simd::Load(ys + i);
+				Simd::Register z = Simd::Load(zs + i);
+
+				Simd::Register lengthSquared = Simd::MultiplyAdd(x, x, Simd::MultiplyAdd(y, y, Simd::Multiply(z, z)));
+				Simd::Register length = Simd::Maximum(Simd::SquareRoot(lengthSquared), smallest);
+
+				Simd::Store(xs + i, Simd::Divide(x, length));
+				Simd::Store(ys + i, Simd::Divide(y, length));
+				Simd::Store(zs + i, Simd::Divide(z, length));
+			}
+
+			NormalizeManyScalar(xs, ys, zs, i, count);
+		}
+
+		static void ComputeBounds4(const float* xs, const float* ys, const float* zs, size_t count, float* minimum, float* maximum)
+		{
+			std::fill_n(minimum, 3, std::numeric_limits<float>::infinity());
+			std::fill_n(maximum, 3, -std::numeric_limits<float>::infinity());
+
+			size_t i = 0;
+
+			if (count >= 4)
+			{
+				Simd::Register minimumX = Simd::Load(xs), minimumY = Simd::Load(ys), minimumZ = Simd::Load(zs);
+				Simd::Register maximumX = minimumX, maximumY = minimumY, maximumZ = minimumZ;
+
+				for (i = 4; i + 4 <= count; i += 4)
+				{
+					Simd::Register x = Simd::Load(xs + i);
+					Simd::Register y = Simd::Load(ys + i);
+					Simd::Register z = Simd::Load(zs + i);
+
+					minimumX = Simd::Minimum(minimumX, x);
+					minimumY = Simd::Minimum(minimumY, y);
+					minimumZ = Simd::Minimum(minimumZ, z);
+
+					maximumX = Simd::Maximum(maximumX, x);
+					maximumY = Simd::Maximum(maximumY, y);
+					maximumZ = Simd::Maximum(maximumZ, z);
+				}
+
+				alignas(16) float lanes[6][4];
+
+				Simd::Store(lanes[0], minimumX);
+				Simd::Store(lanes[1], minimumY);
+				Simd::Store(lanes[2], minimumZ);
+				Simd::Store(lanes[3], maximumX);
+				Simd::Store(lanes[4], maximumY);
+				Simd::Store(lanes[5], maximumZ);
+
+				for (size_t axis = 0; axis < 3; ++axis)
+				{
+					minimum[axis] = *std::min_element(lanes[axis], lanes[axis] + 4);
+					maximum[axis] = *std::max_element(lanes[axis + 3], lanes[axis + 3] + 4);
+				}
+			}
+
+			ComputeBoundsScalar(xs, ys, zs, i, count, minimum, maximum);
+		}
+
+		static void MultiplyMatrices4(const float* first, const float* second, float* destination, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+				Simd::MultiplyMatrix4x4(first + i * 16, second + i * 16, destination + i * 16);
+		}
+
+#if defined(WASTELAND_TARGET_AVX2)
+		static bool SupportsAvx2()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			int registers[4];
+
+			__cpuid(registers, 0);
+
+			if (registers[0] < 7)
+				return false;
+
+			__cpuid(registers, 1);
+
+			bool hasFma = (registers[2] & (1 << 12)) != 0;
+			bool hasOsSave = (registers[2] & (1 << 27)) != 0;
+
+			if (!hasFma || !hasOsSave || (_xgetbv(0) & 0x6) != 0x6)
+				return false;
+
+			__cpuidex(registers, 7, 0);
+
+			return (registers[1] & (1 << 5)) != 0;
+#else
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+		}
+
+		WASTELAND_TARGET_AVX2 static void TransformPointsAvx2(const float* m, const float* xs, const float* ys, const float* zs, float* outputXs, float* outputYs, float* outputZs, size_t count)
+		{
+			__m256 m00 = _mm256_set1_ps(m[0]), m01 = _mm256_set1_ps(m[4]), m02 = _mm256_set1_ps(m[8]), m03 = _mm256_set1_ps(m[12]);
+			__m256 m10 = _mm256_set1_ps(m[1]), m11 = _mm256_set1_ps(m[5]), m12 = _mm256_set1_ps(m[9]), m13 = _mm256_set1_ps(m[13]);
+			__m256 m20 = _mm256_set1_ps(m[2]), m21 = _mm256_set1_ps(m[6]), m22 = _mm256_set1_ps(m[10]), m23 = _mm256_set1_ps(m[14]);
+
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x = _mm256_loadu_ps(xs + i);
+				__m256 y = _mm256_loadu_ps(ys + i);
+				__m256 z = _mm256_loadu_ps(zs + i);
+
+				_mm256_storeu_ps(outputXs + i, _mm256_fmadd_ps(m00, x, _mm256_fmadd_ps(m01, y, _mm256_fmadd_ps(m02, z, m03))));
+				_mm256_storeu_ps(outputYs + i, _mm256_fmadd_ps(m10, x, _mm256_fmadd_ps(m11, y, _mm256_fmadd_ps(m12, z, m13))));
+				_mm256_storeu_ps(outputZs + i, _mm256_fmadd_ps(m20, x, _mm256_fmadd_ps(m21, y, _mm256_fmadd_ps(m22, z, m23))));
+			}
+
+			TransformPointsScalar(m, xs, ys, zs, outputXs, outputYs, outputZs, i, count);
+		}
+
+		WASTELAND_TARGET_AVX2 static void NormalizeManyAvx2(float* xs, float* ys, float* zs, size_t count)
+		{
+			__m256 smallest = _mm256_set1_ps(std::numeric_limits<float>::min());
+
+			size_t i = 0;
+
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x = _mm256_loadu_ps(xs + i);
+				__m256 y = _mm256_loadu_ps(ys + i);
+				__m256 z = _mm256_loadu_ps(zs + i);
+
+				__m256 lengthSquared = _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z)));
+				__m256 length = _mm256_max_ps(_mm256_sqrt_ps(lengthSquared), smallest);
+
+				_mm256_storeu_ps(xs + i, _mm256_div_ps(x, length));
+				_mm256_storeu_ps(ys + i, _mm256_div_ps(y, length));
+				_mm256_storeu_ps(zs + i, _mm256_div_ps(z, length));
+			}
+
+			NormalizeManyScalar(xs, ys, zs, i, count);
+		}
+
+		WASTELAND_TARGET_AVX2 static void ComputeBoundsAvx2(const float* xs, const float* ys, const float* zs, size_t count, float* minimum, float* maximum)
+		{
+			std::fill_n(minimum, 3, std::numeric_limits<float>::infinity());
+			std::fill_n(maximum, 3, -std::numeric_limits<float>::infinity());
+
+			size_t i = 0;
+
+			if (count >= 8)
+			{
+				__m256 minimumX = _mm256_loadu_ps(xs), minimumY = _mm256_loadu_ps(ys), minimumZ = _mm256_loadu_ps(zs);
+				__m256 maximumX = minimumX, maximumY = minimumY, maximumZ = minimumZ;
+
+				for (i = 8; i + 8 <= count; i += 8)
+				{
+					__m256 x = _mm256_loadu_ps(xs + i);
+					__m256 y = _mm256_loadu_ps(ys + i);
+					__m256 z = _mm256_loadu_ps(zs + i);
+
+					minimumX = _mm256_min_ps(minimumX, x);
+					minimumY = _mm256_min_ps(minimumY, y);
+					minimumZ = _mm256_min_ps(minimumZ, z);
+
+					maximumX = _mm256_max_ps(maximumX, x);
+					maximumY = _mm256_max_ps(maximumY, y);
+					maximumZ = _mm256_max_ps(maximumZ, z);
+				}
+
+				alignas(32) float lanes[6][8];
+
+				_mm256_store_ps(lanes[0], minimumX);
+				_mm256_store_ps(lanes[1], minimumY);
+				_mm256_store_ps(lanes[2], minimumZ);
+				_mm256_store_ps(lanes[3], maximumX);
+				_mm256_store_ps(lanes[4], maximumY);
+				_mm256_store_ps(lanes[5], maximumZ);
+
+				for (size_t axis = 0; axis < 3; ++axis)
+				{
+					minimum[axis] = *std::min_element(lanes[axis], lanes[axis] + 8);
+					maximum[axis] = *std::max_element(lanes[axis + 3], lanes[axis + 3] + 8);
+				}
+			}
+
+			ComputeBoundsScalar(xs, ys, zs, i, count, minimum, maximum);
+		}
+
+		WASTELAND_TARGET_AVX2 static void MultiplyMatricesAvx2(const float* first, const float* second, float* destination, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float* a = first + i * 16;
+				const float* b = second + i * 16;
+
+				__m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a));
+				__m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+				__m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+				__m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+
+				__m256 b01 = _mm256_loadu_ps(b);
+				__m256 b23 = _mm256_loadu_ps(b + 8);
+
+				__m256 c01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+				__m256 c23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+
+				c01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), c01);
+				c23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), c23);
+				c01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xAA), c01);
+				c23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xAA), c23);
+				c01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xFF), c01);
+				c23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xFF), c23);
+
+				_mm256_storeu_ps(destination + i * 16, c01);
+				_mm256_storeu_ps(destination + i * 16 + 8, c23);
+			}
+		}
+#endif
+
+	};
+}
\ No newline at end of file
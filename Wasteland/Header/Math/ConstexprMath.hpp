@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <numbers>
+
+namespace Wasteland::Math
+{
+	class ConstexprMath final
+	{
+
+	public:
+
+		ConstexprMath(const ConstexprMath&) = delete;
+		ConstexprMath(ConstexprMath&&) = delete;
+		ConstexprMath& operator=(const ConstexprMath&) = delete;
+		ConstexprMath& operator=(ConstexprMath&&) = delete;
+
+		template <typename T>
+		static constexpr T Abs(T value)
+		{
+			return value < T(0) ? -value : value;
+		}
+
+		template <typename T>
+		static constexpr T Sqrt(T value)
+		{
+			if !consteval
+			{
+				return static_cast<T>(std::sqrt(value));
+			}
+
+			if (value < T(0))
+				return std::numeric_limits<T>::quiet_NaN();
+
+			if (value == T(0) || value == std::numeric_limits<T>::infinity())
+				return value;
+
+			double input = static_cast<double>(value);
+			double current = input >= 1.0 ? input : 1.0;
+			double previous = 0.0;
+
+			while (current != previous)
+			{
+				previous = current;
+				current = 0.5 * (current + input / current);
+
+				if (current >= previous)
+					break;
+			}
+
+			return static_cast<T>(previous < current ? previous : current);
+		}
+
+		template <std::floating_point T>
+		static constexpr T Sin(T radians)
+		{
+			if !consteval
+			{
+				return std::sin(radians);
+			}
+
+			return static_cast<T>(SinSeries(Reduce(static_cast<double>(radians))));
+		}
+
+		template <std::floating_point T>
+		static constexpr T Cos(T radians)
+		{
+			if !consteval
+			{
+				return std::cos(radians);
+			}
+
+			return static_cast<T>(SinSeries(Reduce(static_cast<double>(radians) + std::numbers::pi / 2.0)));
+		}
+
+		template <std::floating_point T>
+		static constexpr T Tan(T radians)
+		{
+			if !consteval
+			{
+				return std::tan(radians);
+			}
+
+			return static_cast<T>(SinSeries(Reduce(static_cast<double>(radians))) / SinSeries(Reduce(static_cast<double>(radians) + std::numbers::pi / 2.0)));
+		}
+
+	private:
+
+		ConstexprMath() = default;
+
+		static constexpr double Reduce(double radians)
+		{
+			constexpr double twoPi = 2.0 * std::numbers::pi;
+
+			double turns = radians / twoPi;
+			long long whole = static_cast<long long>(turns);
+
+			if (turns < 0.0 && static_cast<double>(whole) != turns)
+				--whole;
+
+			double reduced = radians - static_cast<double>(whole) * twoPi;
+
+			return reduced > std::numbers::pi ? reduced - twoPi : reduced;
+		}
+
+		static constexpr double SinSeries(double radians)
+		{
+			double squared = radians * radians;
+			double term = radians;
+			double sum = radians;
+
+			for (int i = 1; i < 20; ++i)
+			{
+				term *= -squared / static_cast<double>((2 * i) * (2 * i + 1));
+				sum += term;
+			}
+
+			return sum;
+		}
+
+	};
+}
\ No newline at end of file
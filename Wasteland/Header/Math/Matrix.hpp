@@ -1,6 +1,13 @@
 #pragma once
 
+#include <format>
+#include "Math/ConstexprMath.hpp"
+#include "Math/Quaternion.hpp"
+#include "Math/Simd.hpp"
 #include "Math/Vector.hpp"
+#include "Utility/Exception/Exceptions/IllegalStateException.hpp"
+
+using namespace Wasteland::Utility::Exception::Exceptions;
 
 namespace Wasteland::Math
 {
@@ -24,35 +31,22 @@ namespace Wasteland::Math
 
 		Matrix() = default;
 
-		Matrix(std::initializer_list<std::initializer_list<T>> init)
+		template <size_t... Rows> requires (sizeof...(Rows) == C && ((Rows == R) && ...))
+		constexpr Matrix(const T (&... columns)[Rows])
 		{
-			assert(init.size() == C && "Outer list must have C columns");
 			size_t col = 0;
 
-			for (const auto& columnList : init)
-			{
-				assert(columnList.size() == R && "Each column must have R elements (rows)");
-				size_t row = 0;
-
-				for (T val : columnList)
-				{
-					data[col][row] = val;
-					++row;
-				}
-
-				++col;
-			}
+			((std::copy(columns, columns + R, data[col++].begin())), ...);
 		}
 
 		template <ArrayType U>
-		Matrix(const U& input)
+		constexpr Matrix(const U& input)
 		{
-			assert(std::distance(input.begin(), input.end()) == C);
+			CheckSize(input);
 			size_t col = 0;
 
 			for (const auto& colData : input)
 			{
-				assert(std::distance(colData.begin(), colData.end()) == R);
 				size_t row = 0;
 
 				for (auto val : colData)
@@ -65,24 +59,23 @@ namespace Wasteland::Math
 			}
 		}
 
-		std::array<T, R>& operator[](size_t col)
+		constexpr std::array<T, R>& operator[](size_t col)
 		{
 			return data[col];
 		}
-		const std::array<T, R>& operator[](size_t col) const
+		constexpr const std::array<T, R>& operator[](size_t col) const
 		{
 			return data[col];
 		}
 
 		template <ArrayType U>
-		Matrix& operator=(const U& rhs)
+		constexpr Matrix& operator=(const U& rhs)
 		{
-			assert(std::distance(rhs.begin(), rhs.end()) == C);
+			CheckSize(rhs);
 			size_t col = 0;
 
 			for (auto& colData : rhs)
 			{
-				assert(std::distance(colData.begin(), colData.end()) == R);
 				size_t row = 0;
 
 				for (auto val : colData)
@@ -97,31 +90,7 @@ namespace Wasteland::Math
 			return *this;
 		}
 
-		Matrix& operator=(std::initializer_list<std::initializer_list<T>> rhs)
-		{
-			assert(rhs.size() == C);
-
-			size_t col = 0;
-
-			for (const auto& colList : rhs)
-			{
-				assert(colList.size() == R);
-
-				size_t row = 0;
-
-				for (auto val : colList)
-				{
-					data[col][row] = val;
-					++row;
-				}
-
-				++col;
-			}
-
-			return *this;
-		}
-
-		Matrix operator+(const Matrix& rhs) const
+		constexpr Matrix operator+(const Matrix& rhs) const
 		{
 			Matrix result;
 
@@ -133,7 +102,7 @@ namespace Wasteland::Math
 
 			return result;
 		}
-		Matrix& operator+=(const Matrix& rhs)
+		constexpr Matrix& operator+=(const Matrix& rhs)
 		{
 			for (size_t c = 0; c < C; c++)
 			{
@@ -144,7 +113,7 @@ namespace Wasteland::Math
 			return *this;
 		}
 
-		Matrix operator-(const Matrix& rhs) const
+		constexpr Matrix operator-(const Matrix& rhs) const
 		{
 			Matrix result;
 
@@ -156,7 +125,7 @@ namespace Wasteland::Math
 
 			return result;
 		}
-		Matrix& operator-=(const Matrix& rhs)
+		constexpr Matrix& operator-=(const Matrix& rhs)
 		{
 			for (size_t c = 0; c < C; c++)
 			{
@@ -167,7 +136,7 @@ namespace Wasteland::Math
 			return *this;
 		}
 
-		Matrix operator*(T scalar) const
+		constexpr Matrix operator*(T scalar) const
 		{
 			Matrix result;
 
@@ -179,7 +148,7 @@ namespace Wasteland::Math
 
 			return result;
 		}
-		Matrix& operator*=(T scalar)
+		constexpr Matrix& operator*=(T scalar)
 		{
 			for (size_t c = 0; c < C; c++)
 			{
@@ -191,10 +160,20 @@ namespace Wasteland::Math
 		}
 
 		template <size_t K>
-		Matrix<T, R, K> operator*(const Matrix<T, C, K>& rhs) const
+		constexpr Matrix<T, R, K> operator*(const Matrix<T, C, K>& rhs) const
 		{
 			Matrix<T, R, K> result;
 
+			if constexpr (IS_SIMD && K == 4)
+			{
+				if !consteval
+				{
+					Simd::MultiplyMatrix4x4(data[0].data(), rhs.data[0].data(), result.data[0].data());
+
+					return result;
+				}
+			}
+
 			for (size_t j = 0; j < K; j++)
 			{
 				for (size_t i = 0; i < R; i++)
@@ -210,13 +189,79 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		Matrix& operator*=(const Matrix& rhs) requires (R == C)
+		constexpr Vector<T, R> operator*(const Vector<T, C>& rhs) const
+		{
+			Vector<T, R> result;
+
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.Data(), Simd::TransformMatrix4x4(data[0].data(), Simd::Load(rhs.Data())));
+
+					return result;
+				}
+			}
+
+			for (size_t i = 0; i < R; i++)
+			{
+				T sum = T(0);
+				for (size_t k = 0; k < C; k++)
+					sum += data[k][i] * rhs[k];
+
+				result[i] = sum;
+			}
+
+			return result;
+		}
+
+		constexpr Vector<T, 3> TransformPoint(const Vector<T, 3>& point) const requires (R == 4 && C == 4)
+		{
+			Vector<T, 3> result;
+
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store3(result.Data(), Simd::TransformMatrix4x4(data[0].data(), Simd::Set(point.x(), point.y(), point.z(), 1.0f)));
+
+					return result;
+				}
+			}
+
+			for (size_t i = 0; i < 3; i++)
+				result[i] = data[0][i] * point.x() + data[1][i] * point.y() + data[2][i] * point.z() + data[3][i];
+
+			return result;
+		}
+
+		constexpr Vector<T, 3> TransformDirection(const Vector<T, 3>& direction) const requires (R == 4 && C == 4)
+		{
+			Vector<T, 3> result;
+
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store3(result.Data(), Simd::TransformMatrix4x4(data[0].data(), Simd::Load3(direction.Data())));
+
+					return result;
+				}
+			}
+
+			for (size_t i = 0; i < 3; i++)
+				result[i] = data[0][i] * direction.x() + data[1][i] * direction.y() + data[2][i] * direction.z();
+
+			return result;
+		}
+
+		constexpr Matrix& operator*=(const Matrix& rhs) requires (R == C)
 		{
 			*this = (*this) * rhs;
 			return *this;
 		}
 
-		static Matrix Identity() requires (R == C)
+		static constexpr Matrix Identity() requires (R == C)
 		{
 			Matrix result;
 			for (size_t c = 0; c < C; c++)
@@ -227,44 +272,137 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		static Matrix Transpose(const Matrix& m)
+		static constexpr Matrix<T, C, R> Transpose(const Matrix& m)
 		{
-			Matrix<T, C, R> tmp;
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Matrix result;
+
+					Simd::TransposeMatrix4x4(m.data[0].data(), result.data[0].data());
+
+					return result;
+				}
+			}
+
+			Matrix<T, C, R> result;
 
 			for (size_t c = 0; c < C; c++)
 			{
 				for (size_t r = 0; r < R; r++)
-					tmp[r][c] = m.data[c][r];
+					result[r][c] = m.data[c][r];
+			}
+
+			return result;
+		}
+
+		static constexpr Matrix Inverse(const Matrix& m) requires (R == C && std::floating_point<T>)
+		{
+			Matrix result;
+
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					if (!Simd::InverseMatrix4x4(m.data[0].data(), result.data[0].data()))
+						throw MAKE_EXCEPTION(IllegalStateException, "Cannot invert a singular matrix!");
+
+					return result;
+				}
+			}
+
+			Matrix source = m;
+
+			result = Identity();
+
+			for (size_t c = 0; c < C; c++)
+			{
+				size_t pivot = c;
+
+				for (size_t r = c + 1; r < R; r++)
+				{
+					if (ConstexprMath::Abs(source.data[r][c]) > ConstexprMath::Abs(source.data[pivot][c]))
+						pivot = r;
+				}
+
+				if (source.data[pivot][c] == T(0))
+					throw MAKE_EXCEPTION(IllegalStateException, "Cannot invert a singular matrix!");
+
+				std::swap(source.data[c], source.data[pivot]);
+				std::swap(result.data[c], result.data[pivot]);
+
+				T scale = T(1) / source.data[c][c];
+
+				for (size_t k = 0; k < R; k++)
+				{
+					source.data[c][k] *= scale;
+					result.data[c][k] *= scale;
+				}
+
+				for (size_t r = 0; r < C; r++)
+				{
+					if (r == c)
+						continue;
+
+					T factor = source.data[r][c];
+
+					for (size_t k = 0; k < R; k++)
+					{
+						source.data[r][k] -= factor * source.data[c][k];
+						result.data[r][k] -= factor * result.data[c][k];
+					}
+				}
+			}
+
+			return result;
+		}
+
+		static constexpr Matrix<T, 4, 4> InverseRigid(const Matrix<T, 4, 4>& m) requires (R == 4 && C == 4)
+		{
+			Matrix<T, 4, 4> result;
+
+			for (size_t c = 0; c < 3; c++)
+			{
+				for (size_t r = 0; r < 3; r++)
+					result.data[c][r] = m.data[r][c];
+
+				result.data[c][3] = T(0);
 			}
 
-			return *(reinterpret_cast<Matrix<T, R, C>*>(&tmp));
+			for (size_t r = 0; r < 3; r++)
+				result.data[3][r] = -(m.data[r][0] * m.data[3][0] + m.data[r][1] * m.data[3][1] + m.data[r][2] * m.data[3][2]);
+
+			result.data[3][3] = T(1);
+
+			return result;
 		}
 
-		static Matrix<T, 4, 4> Perspective(T fovRadians, T aspect, T nearPlane, T farPlane)
+		static constexpr Matrix<T, 4, 4> Perspective(T fovRadians, T aspect, T nearPlane, T farPlane)
 		{
-			T tanHalfFov = std::tan(fovRadians / T(2));
+			T tanHalfFov = ConstexprMath::Tan(fovRadians / T(2));
 
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{ 1 / (aspect * tanHalfFov), 0, 0, 0 },
 				{ 0, 1 / tanHalfFov, 0, 0 },
 				{ 0, 0, -(farPlane + nearPlane) / (farPlane - nearPlane), -1 },
 				{ 0, 0, -(2 * farPlane * nearPlane) / (farPlane - nearPlane), 0 }
-			});
+			};
 		}
 
-		static Matrix<T, 4, 4> Orthographic(T left, T right, T bottom, T top, T nearPlane, T farPlane)
+		static constexpr Matrix<T, 4, 4> Orthographic(T left, T right, T bottom, T top, T nearPlane, T farPlane)
 		{
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{ 2 / (right - left), 0, 0, 0 },
 				{ 0, 2 / (top - bottom), 0, 0 },
 				{ 0, 0, -2 / (farPlane - nearPlane), 0 },
 				{ -(right + left) / (right - left), -(top + bottom) / (top - bottom), -(farPlane + nearPlane) / (farPlane - nearPlane), 1 }
-			});
+			};
 		}
 
-		static Matrix<T, 4, 4> Translation(const Vector<T, 3>& translation)
+		static constexpr Matrix<T, 4, 4> Translation(const Vector<T, 3>& translation)
 		{
 			Matrix<T, 4, 4> result = Identity();
 
@@ -275,90 +413,112 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		static Matrix<T, 4, 4> Scale(const Vector<T, 3>& scale)
+		static constexpr Matrix<T, 4, 4> TranslationRotationScale(const Vector<T, 3>& translation, const Quaternion<T>& rotation, const Vector<T, 3>& scale) requires std::floating_point<T>
+		{
+			T xx = rotation.x() * rotation.x();
+			T yy = rotation.y() * rotation.y();
+			T zz = rotation.z() * rotation.z();
+			T xy = rotation.x() * rotation.y();
+			T xz = rotation.x() * rotation.z();
+			T yz = rotation.y() * rotation.z();
+			T wx = rotation.w() * rotation.x();
+			T wy = rotation.w() * rotation.y();
+			T wz = rotation.w() * rotation.z();
+
+			Matrix<T, 4, 4> result;
+
+			result.data[0] = { (1 - 2 * (yy + zz)) * scale.x(), 2 * (xy + wz) * scale.x(), 2 * (xz - wy) * scale.x(), 0 };
+			result.data[1] = { 2 * (xy - wz) * scale.y(), (1 - 2 * (xx + zz)) * scale.y(), 2 * (yz + wx) * scale.y(), 0 };
+			result.data[2] = { 2 * (xz + wy) * scale.z(), 2 * (yz - wx) * scale.z(), (1 - 2 * (xx + yy)) * scale.z(), 0 };
+			result.data[3] = { translation.x(), translation.y(), translation.z(), 1 };
+
+			return result;
+		}
+
+		static constexpr Matrix<T, 4, 4> Scale(const Vector<T, 3>& scale)
 		{
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{ scale.x(), 0,         0,         0 },
 				{ 0,         scale.y(), 0,         0 },
 				{ 0,         0,         scale.z(), 0 },
 				{ 0,         0,         0,         1 }
-			});
+			};
 		}
 
-		static Matrix<T, 4, 4> RotationX(T angleRadians)
+		static constexpr Matrix<T, 4, 4> RotationX(T angleRadians)
 		{
-			T c = std::cos(angleRadians);
-			T s = std::sin(angleRadians);
+			T c = ConstexprMath::Cos(angleRadians);
+			T s = ConstexprMath::Sin(angleRadians);
 
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{ 1,  0, 0, 0 },
 				{ 0,  c, s, 0 },
 				{ 0, -s, c, 0 },
 				{ 0,  0, 0, 1 }
-			});
+			};
 		}
 
-		static Matrix<T, 4, 4> RotationY(T angleRadians)
+		static constexpr Matrix<T, 4, 4> RotationY(T angleRadians)
 		{
-			T c = std::cos(angleRadians);
-			T s = std::sin(angleRadians);
+			T c = ConstexprMath::Cos(angleRadians);
+			T s = ConstexprMath::Sin(angleRadians);
 
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{  c, 0, -s, 0 },
 				{  0, 1,  0, 0 },
 				{  s, 0,  c, 0 },
 				{  0, 0,  0, 1 }
-			});
+			};
 		}
 
-		static Matrix<T, 4, 4> RotationZ(T angleRadians)
+		static constexpr Matrix<T, 4, 4> RotationZ(T angleRadians)
 		{
-			T c = std::cos(angleRadians);
-			T s = std::sin(angleRadians);
+			T c = ConstexprMath::Cos(angleRadians);
+			T s = ConstexprMath::Sin(angleRadians);
 
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{ c,  s, 0, 0 },
 				{ -s, c, 0, 0 },
 				{ 0,  0, 1, 0 },
 				{ 0,  0, 0, 1 }
-			});
+			};
 		}
 
-		static Matrix<T, 4, 4> LookAt(const Vector<T, 3>& eye, const Vector<T, 3>& center, const Vector<T, 3>& up)
+		static constexpr Matrix<T, 4, 4> LookAt(const Vector<T, 3>& eye, const Vector<T, 3>& center, const Vector<T, 3>& up)
 		{
 			auto fwd = Vector<T, 3>::Normalize(eye - center);
 			auto right = Vector<T, 3>::Normalize(Vector<T, 3>::Cross(up, fwd));
 			auto realUp = Vector<T, 3>::Cross(fwd, right);
 
-			return Matrix<T, 4, 4>(
+			return Matrix<T, 4, 4>
 			{
 				{ right.x(),   realUp.x(),   fwd.x(),   T(0) },
 				{ right.y(),   realUp.y(),   fwd.y(),   T(0) },
 				{ right.z(),   realUp.z(),   fwd.z(),   T(0) },
 				{ -Vector<T,3>::Dot(right,eye), -Vector<T,3>::Dot(realUp,eye), -Vector<T,3>::Dot(fwd,eye), T(1) }
-			});
+			};
 		}
 
-		auto begin()
+		constexpr auto begin()
 		{
 			return data.begin();
 		}
 
-		auto end()
+		constexpr auto end()
 		{
 			return data.end();
 		}
 
-		auto begin() const
+		constexpr auto begin() const
 		{
 			return data.begin();
 		}
 
-		auto end() const
+		constexpr auto end() const
 		{
 			return data.end();
 		}
@@ -375,14 +535,37 @@ namespace Wasteland::Math
 
 	private:
 
-		std::array<std::array<T, R>, C> data;
+		static constexpr bool IS_SIMD = std::same_as<T, float> && R == 4 && C == 4;
+
+		alignas(IS_SIMD ? 16 : alignof(T)) std::array<std::array<T, R>, C> data;
+
+		template <Arithmetic U, size_t RU, size_t CU>
+		friend class Matrix;
+
+		template <ArrayType U>
+		static constexpr void CheckSize(const U& input)
+		{
+			if constexpr (STATIC_SIZE<U> != std::dynamic_extent)
+			{
+				static_assert(STATIC_SIZE<U> == C, "Operand must have C columns");
+				static_assert(STATIC_SIZE<typename U::value_type> == std::dynamic_extent || STATIC_SIZE<typename U::value_type> == R, "Each column must have R rows");
+			}
+			else
+				assert(std::distance(input.begin(), input.end()) == C);
 
-		friend bool operator==(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs);
-		friend bool operator!=(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs);
+			if constexpr (STATIC_SIZE<typename U::value_type> == std::dynamic_extent)
+			{
+				for (const auto& column : input)
+					assert(std::distance(column.begin(), column.end()) == R);
+			}
+		}
+
+		template <Arithmetic U, size_t RU, size_t CU>
+		friend constexpr bool operator==(const Matrix<U, RU, CU>& lhs, const Matrix<U, RU, CU>& rhs);
 	};
 
 	template <Arithmetic T, size_t R, size_t C>
-	bool operator==(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs)
+	constexpr bool operator==(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs)
 	{
 		for (size_t col = 0; col < C; col++)
 		{
@@ -397,7 +580,7 @@ namespace Wasteland::Math
 	}
 
 	template <Arithmetic T, size_t R, size_t C>
-	bool operator!=(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs)
+	constexpr bool operator!=(const Matrix<T, R, C>& lhs, const Matrix<T, R, C>& rhs)
 	{
 		return !(lhs == rhs);
 	}
@@ -426,6 +609,14 @@ namespace Wasteland::Math
 
 		return os;
 	}
+
+	static_assert(Matrix<float, 4, 4>::Identity() * Matrix<float, 4, 4>::Translation({ 1.0f, 2.0f, 3.0f }) == Matrix<float, 4, 4>::Translation({ 1.0f, 2.0f, 3.0f }));
+	static_assert(Matrix<float, 4, 4>::Translation({ 1.0f, 2.0f, 3.0f }).TransformPoint({ 1.0f, 1.0f, 1.0f }) == Vector<float, 3>{ 2.0f, 3.0f, 4.0f });
+	static_assert(Matrix<float, 4, 4>::Inverse(Matrix<float, 4, 4>::Scale({ 2.0f, 4.0f, 8.0f })) == Matrix<float, 4, 4>::Scale({ 0.5f, 0.25f, 0.125f }));
+	static_assert(Matrix<float, 4, 4>::InverseRigid(Matrix<float, 4, 4>::RotationY(0.5f)) == Matrix<float, 4, 4>::Transpose(Matrix<float, 4, 4>::RotationY(0.5f)));
+	static_assert(Matrix<float, 4, 4>::InverseRigid(Matrix<float, 4, 4>::Translation({ 1.0f, 2.0f, 3.0f })) == Matrix<float, 4, 4>::Translation({ -1.0f, -2.0f, -3.0f }));
+	static_assert(Matrix<float, 4, 4>::Transpose(Matrix<float, 4, 4>::Transpose(Matrix<float, 4, 4>::RotationX(1.0f))) == Matrix<float, 4, 4>::RotationX(1.0f));
+	static_assert(Matrix<float, 4, 4>::LookAt({ 0.0f, 0.0f, 5.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }).TransformPoint({ 0.0f, 0.0f, 0.0f }) == Vector<float, 3>{ 0.0f, 0.0f, -5.0f });
 }
 
 namespace std
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include "Math/ConstexprMath.hpp"
+#include "Math/Vector.hpp"
+
+namespace Wasteland::Math
+{
+	template <std::floating_point T>
+	class Quaternion final
+	{
+
+	public:
+
+		using value_type = T;
+
+		Quaternion() = default;
+
+		constexpr Quaternion(T x, T y, T z, T w) : data({ x, y, z, w }) { }
+
+		constexpr bool operator==(const Quaternion& operand) const
+		{
+			return data == operand.data;
+		}
+
+		constexpr bool operator!=(const Quaternion& operand) const
+		{
+			return !(*this == operand);
+		}
+
+		constexpr Quaternion operator*(const Quaternion& operand) const
+		{
+			return
+			{
+				w() * operand.x() + x() * operand.w() + y() * operand.z() - z() * operand.y(),
+				w() * operand.y() - x() * operand.z() + y() * operand.w() + z() * operand.x(),
+				w() * operand.z() + x() * operand.y() - y() * operand.x() + z() * operand.w(),
+				w() * operand.w() - x() * operand.x() - y() * operand.y() - z() * operand.z()
+			};
+		}
+
+		constexpr Quaternion& operator*=(const Quaternion& operand)
+		{
+			*this = *this * operand;
+
+			return *this;
+		}
+
+		constexpr Vector<T, 3> operator*(const Vector<T, 3>& operand) const
+		{
+			Vector<T, 3> axis = { x(), y(), z() };
+
+			Vector<T, 3> t = Vector<T, 3>::Cross(axis, operand) * T(2);
+
+			return operand + t * w() + Vector<T, 3>::Cross(axis, t);
+		}
+
+		constexpr T& x()
+		{
+			return data[0];
+		}
+
+		constexpr T x() const
+		{
+			return data[0];
+		}
+
+		constexpr T& y()
+		{
+			return data[1];
+		}
+
+		constexpr T y() const
+		{
+			return data[1];
+		}
+
+		constexpr T& z()
+		{
+			return data[2];
+		}
+
+		constexpr T z() const
+		{
+			return data[2];
+		}
+
+		constexpr T& w()
+		{
+			return data[3];
+		}
+
+		constexpr T w() const
+		{
+			return data[3];
+		}
+
+		static constexpr Quaternion Identity()
+		{
+			return { };
+		}
+
+		static constexpr T Dot(const Quaternion& first, const Quaternion& second)
+		{
+			return first.x() * second.x() + first.y() * second.y() + first.z() * second.z() + first.w() * second.w();
+		}
+
+		static constexpr Quaternion Normalize(const Quaternion& first)
+		{
+			T magnitude = ConstexprMath::Sqrt(Dot(first, first));
+
+			if (magnitude == T(0))
+				return Identity();
+
+			return { first.x() / magnitude, first.y() / magnitude, first.z() / magnitude, first.w() / magnitude };
+		}
+
+		static constexpr Quaternion Conjugate(const Quaternion& first)
+		{
+			return { -first.x(), -first.y(), -first.z(), first.w() };
+		}
+
+		static constexpr Quaternion AngleAxis(T angleRadians, const Vector<T, 3>& axis)
+		{
+			Vector<T, 3> unit = Vector<T, 3>::Normalize(axis);
+
+			T s = ConstexprMath::Sin(angleRadians * T(0.5));
+
+			return { unit.x() * s, unit.y() * s, unit.z() * s, ConstexprMath::Cos(angleRadians * T(0.5)) };
+		}
+
+		static constexpr Quaternion FromEulerAngles(const Vector<T, 3>& degrees)
+		{
+			const T halfDegreesToRadians = std::numbers::pi_v<T> / T(360);
+
+			T cx = ConstexprMath::Cos(degrees.x() * halfDegreesToRadians);
+			T sx = ConstexprMath::Sin(degrees.x() * halfDegreesToRadians);
+			T cy = ConstexprMath::Cos(degrees.y() * halfDegreesToRadians);
+			T sy = ConstexprMath::Sin(degrees.y() * halfDegreesToRadians);
+			T cz = ConstexprMath::Cos(degrees.z() * halfDegreesToRadians);
+			T sz = ConstexprMath::Sin(degrees.z() * halfDegreesToRadians);
+
+			return
+			{
+				cz * cy * sx - sz * sy * cx,
+				cz * sy * cx + sz * cy * sx,
+				sz * cy * cx - cz * sy * sx,
+				cz * cy * cx + sz * sy * sx
+			};
+		}
+
+		static Vector<T, 3> ToEulerAngles(const Quaternion& first)
+		{
+			const T radiansToDegrees = T(180) / std::numbers::pi_v<T>;
+
+			T roll = std::atan2(T(2) * (first.w() * first.x() + first.y() * first.z()), T(1) - T(2) * (first.x() * first.x() + first.y() * first.y()));
+			T pitch = std::asin(std::clamp(T(2) * (first.w() * first.y() - first.z() * first.x()), T(-1), T(1)));
+			T yaw = std::atan2(T(2) * (first.w() * first.z() + first.x() * first.y()), T(1) - T(2) * (first.y() * first.y() + first.z() * first.z()));
+
+			return { roll * radiansToDegrees, pitch * radiansToDegrees, yaw * radiansToDegrees };
+		}
+
+	private:
+
+		std::array<T, 4> data = { T(0), T(0), T(0), T(1) };
+
+	};
+}
\ No newline at end of file
@@ -4,16 +4,19 @@
 #include "Collider/PhysicsGlobal.hpp"
 #include "Collider/Colliders/ColliderMesh.hpp"
 #include "ECS/GameObject.hpp"
+#include "ECS/ObjectPool.hpp"
+#include "Utility/CoordinateHelper.hpp"
 #include "Utility/Exception/Exceptions/NullPointerException.hpp"
 
 using namespace Wasteland::Collider;
 using namespace Wasteland::Collider::Colliders;
 using namespace Wasteland::ECS;
+using namespace Wasteland::Utility;
 
 namespace Wasteland::Math
 {
     template <ColliderShape T>
-    class Rigidbody final : public Component
+    class Rigidbody final : public Component, public Pooled<Rigidbody<T>>
     {
 
     public:
@@ -22,7 +25,7 @@ namespace Wasteland::Math
         {
             if (handle)
             {
-                PhysicsGlobal::GetInstance().GetWorld()->removeRigidBody(handle);
+                PhysicsGlobal::GetInstance().RemoveBody(handle, !isStatic, isParked);
 
                 delete handle;
 
@@ -37,8 +40,6 @@ namespace Wasteland::Math
 
         void Initialize() override
         {
-            auto collider = Super::GetGameObject()->template GetComponent<ColliderBase<T>>().value_or(nullptr);
-
             if (!collider)
                 throw std::runtime_error("Collider was null...");
 
@@ -61,11 +62,15 @@ namespace Wasteland::Math
 
             handle = new btRigidBody(rbInfo);
 
+            Vector<float, 3> position = transform->GetLocalPosition();
+            Quaternion<float> rotation = transform->GetLocalRotation();
+
+            handle->getWorldTransform().setOrigin({ position.x(), position.y(), position.z() });
+            handle->getWorldTransform().setRotation({ rotation.x(), rotation.y(), rotation.z(), rotation.w() });
+
             if (isStatic)
                 handle->setCollisionFlags(handle->getCollisionFlags() | btCollisionObject::CF_STATIC_OBJECT);
                                         
-            short group, mask;
-
             if (isStatic)
             {
                 group = btBroadphaseProxy::StaticFilter;
@@ -77,31 +82,26 @@ namespace Wasteland::Math
                 mask  = btBroadphaseProxy::AllFilter;
             }
 
-            PhysicsGlobal::GetInstance().GetWorld()->addRigidBody(handle, group, mask);
+            PhysicsGlobal::GetInstance().AddBody(handle, group, mask, !isStatic);
 
-            Super::GetGameObject()->GetTransform()->AddOnPositionChangedCallback([&](Vector<float, 3> position)
-            {
-                handle->getWorldTransform().setOrigin({ position.x(), position.y(), position.z() });
-            });
-
-            Super::GetGameObject()->GetTransform()->AddOnRotationChangedCallback([&](Vector<float, 3> rotation)
-            {
-                handle->getWorldTransform().setRotation({ rotation.x(), rotation.y(), rotation.z() });
-            });
+            RegisterTransformConsumer();
         }
 
         void Update() override
         {
             if (handle && !isStatic)
             {
-                btTransform& transform = handle->getWorldTransform();
+                UpdateResidency();
+
+                if (isParked)
+                    return;
 
-                btScalar rx, ry, rz;
+                btTransform& transform = handle->getWorldTransform();
 
-                transform.getRotation().getEulerZYX(rz, ry, rx);
+                btQuaternion rotation = transform.getRotation();
 
-                Super::GetGameObject()->GetTransform()->SetLocalPosition({ transform.getOrigin().getX(), transform.getOrigin().getY(), transform.getOrigin().getZ()}, false);
-                Super::GetGameObject()->GetTransform()->SetLocalRotation({rx, ry, rz}, false);
+                this->transform->SetLocalPosition({ transform.getOrigin().getX(), transform.getOrigin().getY(), transform.getOrigin().getZ()}, false);
+                this->transform->SetLocalRotation({ rotation.x(), rotation.y(), rotation.z(), rotation.w() }, false);
             }
         }
 
@@ -176,9 +176,19 @@ namespace Wasteland::Math
             return handle; 
         }
 
+        bool IsParked() const
+        {
+            return isParked;
+        }
+
+        static SystemAccess GetSystemAccess()
+        {
+            return SystemAccess().Write<Transform, PhysicsGlobal>().Parallel(UPDATE_GRAIN_SIZE);
+        }
+
         static std::shared_ptr<Rigidbody> Create(float mass, bool isStatic = false)
         {
-            auto result = std::shared_ptr<Rigidbody>(new Rigidbody());
+            auto result = MakePooledShared(new Rigidbody());
 
             result->mass = mass;
             result->isStatic = isStatic;
@@ -188,11 +198,95 @@ namespace Wasteland::Math
 
     private:
 
+        static constexpr size_t UPDATE_GRAIN_SIZE = 256;
+
         Rigidbody() = default;
 
+        static void RegisterTransformConsumer()
+        {
+            static const bool isRegistered = (TransformHierarchy::GetInstance().AddConsumer(&Rigidbody::ApplyTransformChanges), true);
+
+            (void)isRegistered;
+        }
+
+        static void ApplyTransformChanges(std::span<const TransformChange> changes)
+        {
+            const auto& storage = ComponentStorage<Rigidbody>::GetInstance();
+
+            for (const auto& change : changes)
+            {
+                Rigidbody* rigidbody = storage.Get(change.entity);
+
+                if (!rigidbody || !rigidbody->handle)
+                    continue;
+
+                btTransform& worldTransform = rigidbody->handle->getWorldTransform();
+
+                if (change.flags & Transform::CHANGED_POSITION)
+                {
+                    Vector<float, 3> position = change.transform->GetLocalPosition();
+
+                    worldTransform.setOrigin({ position.x(), position.y(), position.z() });
+                }
+
+                if (change.flags & Transform::CHANGED_ROTATION)
+                {
+                    Quaternion<float> rotation = change.transform->GetLocalRotation();
+
+                    worldTransform.setRotation({ rotation.x(), rotation.y(), rotation.z(), rotation.w() });
+                }
+            }
+        }
+
+        void UpdateResidency()
+        {
+            const btVector3& origin = handle->getWorldTransform().getOrigin();
+
+            Vector<int, 3> chunk = CoordinateHelper::WorldToChunkCoordinates({ origin.getX(), origin.getY(), origin.getZ() });
+
+            bool isResident = PhysicsGlobal::GetInstance().IsColumnResident({ chunk.x(), chunk.z() });
+
+            if (isResident && isParked)
+                Unpark();
+            else if (!isResident && !isParked)
+                Park();
+        }
+
+        void Park()
+        {
+            parkedLinearVelocity = handle->getLinearVelocity();
+            parkedAngularVelocity = handle->getAngularVelocity();
+
+            PhysicsGlobal::GetInstance().ParkBody(handle);
+
+            isParked = true;
+        }
+
+        void Unpark()
+        {
+            PhysicsGlobal::GetInstance().UnparkBody(handle, group, mask);
+
+            handle->setLinearVelocity(parkedLinearVelocity);
+            handle->setAngularVelocity(parkedAngularVelocity);
+            handle->activate(true);
+
+            isParked = false;
+        }
+
         float mass = 0.f;
         bool isStatic = false;
 
         btRigidBody* handle = nullptr;
+
+        short group = 0;
+        short mask = 0;
+
+        bool isParked = false;
+
+        btVector3 parkedLinearVelocity = { 0, 0, 0 };
+        btVector3 parkedAngularVelocity = { 0, 0, 0 };
+
+        Dependency<Transform> transform{ this };
+        Dependency<ColliderBase<T>> collider{ this };
     };
 }
\ No newline at end of file
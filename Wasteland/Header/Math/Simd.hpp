@@ -0,0 +1,408 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define WASTELAND_SIMD_SSE
+	#include <immintrin.h>
+#elif defined(__ARM_NEON) && (defined(__clang__) || defined(__GNUC__))
+	#define WASTELAND_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace Wasteland::Math
+{
+	class Simd final
+	{
+
+	public:
+
+#if defined(WASTELAND_SIMD_SSE)
+		using Register = __m128;
+#elif defined(WASTELAND_SIMD_NEON)
+		using Register = float32x4_t;
+#else
+		struct Register
+		{
+			std::array<float, 4> lanes;
+		};
+#endif
+
+		Simd(const Simd&) = delete;
+		Simd(Simd&&) = delete;
+		Simd& operator=(const Simd&) = delete;
+		Simd& operator=(Simd&&) = delete;
+
+		static Register Load(const float* source)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_loadu_ps(source);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vld1q_f32(source);
+#else
+			return { { source[0], source[1], source[2], source[3] } };
+#endif
+		}
+
+		static Register Load3(const float* source)
+		{
+			return Set(source[0], source[1], source[2], 0.0f);
+		}
+
+		static void Store(float* destination, Register value)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			_mm_storeu_ps(destination, value);
+#elif defined(WASTELAND_SIMD_NEON)
+			vst1q_f32(destination, value);
+#else
+			std::copy(value.lanes.begin(), value.lanes.end(), destination);
+#endif
+		}
+
+		static void Store3(float* destination, Register value)
+		{
+			alignas(16) float lanes[4];
+
+			Store(lanes, value);
+
+			destination[0] = lanes[0];
+			destination[1] = lanes[1];
+			destination[2] = lanes[2];
+		}
+
+		static Register Set(float x, float y, float z, float w)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_setr_ps(x, y, z, w);
+#elif defined(WASTELAND_SIMD_NEON)
+			alignas(16) const float lanes[4] = { x, y, z, w };
+
+			return vld1q_f32(lanes);
+#else
+			return { { x, y, z, w } };
+#endif
+		}
+
+		static Register Splat(float value)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_set1_ps(value);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vdupq_n_f32(value);
+#else
+			return { { value, value, value, value } };
+#endif
+		}
+
+		static Register Add(Register first, Register second)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_add_ps(first, second);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vaddq_f32(first, second);
+#else
+			return Apply(first, second, [](float a, float b) { return a + b; });
+#endif
+		}
+
+		static Register Subtract(Register first, Register second)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_sub_ps(first, second);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vsubq_f32(first, second);
+#else
+			return Apply(first, second, [](float a, float b) { return a - b; });
+#endif
+		}
+
+		static Register Multiply(Register first, Register second)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_mul_ps(first, second);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vmulq_f32(first, second);
+#else
+			return Apply(first, second, [](float a, float b) { return a * b; });
+#endif
+		}
+
+		static Register Divide(Register first, Register second)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_div_ps(first, second);
+#elif defined(WASTELAND_SIMD_NEON) && defined(__aarch64__)
+			return vdivq_f32(first, second);
+#else
+			alignas(16) float a[4];
+			alignas(16) float b[4];
+
+			Store(a, first);
+			Store(b, second);
+
+			return Set(a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3]);
+#endif
+		}
+
+		static Register SquareRoot(Register value)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_sqrt_ps(value);
+#elif defined(WASTELAND_SIMD_NEON) && defined(__aarch64__)
+			return vsqrtq_f32(value);
+#else
+			alignas(16) float lanes[4];
+
+			Store(lanes, value);
+
+			return Set(std::sqrt(lanes[0]), std::sqrt(lanes[1]), std::sqrt(lanes[2]), std::sqrt(lanes[3]));
+#endif
+		}
+
+		static Register Minimum(Register first, Register second)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_min_ps(first, second);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vminq_f32(first, second);
+#else
+			return Apply(first, second, [](float a, float b) { return std::min(a, b); });
+#endif
+		}
+
+		static Register Maximum(Register first, Register second)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_max_ps(first, second);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vmaxq_f32(first, second);
+#else
+			return Apply(first, second, [](float a, float b) { return std::max(a, b); });
+#endif
+		}
+
+		static Register MultiplyAdd(Register first, Register second, Register addend)
+		{
+#if defined(WASTELAND_SIMD_SSE) && defined(__FMA__)
+			return _mm_fmadd_ps(first, second, addend);
+#elif defined(WASTELAND_SIMD_NEON) && defined(__aarch64__)
+			return vfmaq_f32(addend, first, second);
+#else
+			return Add(Multiply(first, second), addend);
+#endif
+		}
+
+		template <size_t X, size_t Y, size_t Z, size_t W>
+		static Register Shuffle(Register first, Register second)
+		{
+			static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Shuffle lanes must be in [0, 3]");
+
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_shuffle_ps(first, second, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(WASTELAND_SIMD_NEON)
+			return __builtin_shufflevector(first, second, X, Y, Z + 4, W + 4);
+#else
+			return { { first.lanes[X], first.lanes[Y], second.lanes[Z], second.lanes[W] } };
+#endif
+		}
+
+		template <size_t X, size_t Y, size_t Z, size_t W>
+		static Register Swizzle(Register value)
+		{
+			return Shuffle<X, Y, Z, W>(value, value);
+		}
+
+		template <size_t L>
+		static Register SplatLane(Register value)
+		{
+			return Swizzle<L, L, L, L>(value);
+		}
+
+		static float GetX(Register value)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			return _mm_cvtss_f32(value);
+#elif defined(WASTELAND_SIMD_NEON)
+			return vgetq_lane_f32(value, 0);
+#else
+			return value.lanes[0];
+#endif
+		}
+
+		static float HorizontalSum(Register value)
+		{
+#if defined(WASTELAND_SIMD_SSE)
+			Register sum = _mm_add_ps(value, _mm_movehl_ps(value, value));
+
+			return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+#elif defined(WASTELAND_SIMD_NEON) && defined(__aarch64__)
+			return vaddvq_f32(value);
+#else
+			alignas(16) float lanes[4];
+
+			Store(lanes, value);
+
+			return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+		}
+
+		static float Dot(Register first, Register second)
+		{
+			return HorizontalSum(Multiply(first, second));
+		}
+
+		static Register Cross(Register first, Register second)
+		{
+			Register a = Swizzle<1, 2, 0, 3>(first);
+			Register b = Swizzle<1, 2, 0, 3>(second);
+
+			return Swizzle<1, 2, 0, 3>(Subtract(Multiply(first, b), Multiply(a, second)));
+		}
+
+		static void Transpose(Register& column0, Register& column1, Register& column2, Register& column3)
+		{
+			Register t0 = Shuffle<0, 1, 0, 1>(column0, column1);
+			Register t1 = Shuffle<2, 3, 2, 3>(column0, column1);
+			Register t2 = Shuffle<0, 1, 0, 1>(column2, column3);
+			Register t3 = Shuffle<2, 3, 2, 3>(column2, column3);
+
+			column0 = Shuffle<0, 2, 0, 2>(t0, t2);
+			column1 = Shuffle<1, 3, 1, 3>(t0, t2);
+			column2 = Shuffle<0, 2, 0, 2>(t1, t3);
+			column3 = Shuffle<1, 3, 1, 3>(t1, t3);
+		}
+
+		static void MultiplyMatrix4x4(const float* first, const float* second, float* destination)
+		{
+			Register a0 = Load(first);
+			Register a1 = Load(first + 4);
+			Register a2 = Load(first + 8);
+			Register a3 = Load(first + 12);
+
+			Register result[4];
+
+			for (size_t j = 0; j < 4; ++j)
+			{
+				Register b = Load(second + j * 4);
+
+				Register column = Multiply(a0, SplatLane<0>(b));
+
+				column = MultiplyAdd(a1, SplatLane<1>(b), column);
+				column = MultiplyAdd(a2, SplatLane<2>(b), column);
+				column = MultiplyAdd(a3, SplatLane<3>(b), column);
+
+				result[j] = column;
+			}
+
+			for (size_t j = 0; j < 4; ++j)
+				Store(destination + j * 4, result[j]);
+		}
+
+		static Register TransformMatrix4x4(const float* matrix, Register value)
+		{
+			Register result = Multiply(Load(matrix), SplatLane<0>(value));
+
+			result = MultiplyAdd(Load(matrix + 4), SplatLane<1>(value), result);
+			result = MultiplyAdd(Load(matrix + 8), SplatLane<2>(value), result);
+			result = MultiplyAdd(Load(matrix + 12), SplatLane<3>(value), result);
+
+			return result;
+		}
+
+		static void TransposeMatrix4x4(const float* source, float* destination)
+		{
+			Register c0 = Load(source);
+			Register c1 = Load(source + 4);
+			Register c2 = Load(source + 8);
+			Register c3 = Load(source + 12);
+
+			Transpose(c0, c1, c2, c3);
+
+			Store(destination, c0);
+			Store(destination + 4, c1);
+			Store(destination + 8, c2);
+			Store(destination + 12, c3);
+		}
+
+		static bool InverseMatrix4x4(const float* source, float* destination)
+		{
+			Register c0 = Load(source);
+			Register c1 = Load(source + 4);
+			Register c2 = Load(source + 8);
+			Register c3 = Load(source + 12);
+
+			Register a = Shuffle<0, 1, 0, 1>(c0, c1);
+			Register b = Shuffle<2, 3, 2, 3>(c0, c1);
+			Register c = Shuffle<0, 1, 0, 1>(c2, c3);
+			Register d = Shuffle<2, 3, 2, 3>(c2, c3);
+
+			Register subDeterminants = Subtract(Multiply(Shuffle<0, 2, 0, 2>(c0, c2), Shuffle<1, 3, 1, 3>(c1, c3)), Multiply(Shuffle<1, 3, 1, 3>(c0, c2), Shuffle<0, 2, 0, 2>(c1, c3)));
+
+			Register determinantA = SplatLane<0>(subDeterminants);
+			Register determinantB = SplatLane<1>(subDeterminants);
+			Register determinantC = SplatLane<2>(subDeterminants);
+			Register determinantD = SplatLane<3>(subDeterminants);
+
+			Register adjugateDC = AdjugateMultiply2x2(d, c);
+			Register adjugateAB = AdjugateMultiply2x2(a, b);
+
+			Register x = Subtract(Multiply(determinantD, a), Multiply2x2(b, adjugateDC));
+			Register w = Subtract(Multiply(determinantA, d), Multiply2x2(c, adjugateAB));
+			Register y = Subtract(Multiply(determinantB, c), MultiplyAdjugate2x2(d, adjugateAB));
+			Register z = Subtract(Multiply(determinantC, b), MultiplyAdjugate2x2(a, adjugateDC));
+
+			float trace = Dot(adjugateAB, Swizzle<0, 2, 1, 3>(adjugateDC));
+
+			float determinant = GetX(Subtract(Add(Multiply(determinantA, determinantD), Multiply(determinantB, determinantC)), Splat(trace)));
+
+			if (determinant == 0.0f)
+				return false;
+
+			Register reciprocal = Divide(Set(1.0f, -1.0f, -1.0f, 1.0f), Splat(determinant));
+
+			x = Multiply(x, reciprocal);
+			y = Multiply(y, reciprocal);
+			z = Multiply(z, reciprocal);
+			w = Multiply(w, reciprocal);
+
+			Store(destination, Shuffle<3, 1, 3, 1>(x, y));
+			Store(destination + 4, Shuffle<2, 0, 2, 0>(x, y));
+			Store(destination + 8, Shuffle<3, 1, 3, 1>(z, w));
+			Store(destination + 12, Shuffle<2, 0, 2, 0>(z, w));
+
+			return true;
+		}
+
+	private:
+
+		Simd() = default;
+
+#if !defined(WASTELAND_SIMD_SSE) && !defined(WASTELAND_SIMD_NEON)
+		template <typename Function>
+		static Register Apply(Register first, Register second, Function function)
+		{
+			return { { function(first.lanes[0], second.lanes[0]), function(first.lanes[1], second.lanes[1]), function(first.lanes[2], second.lanes[2]), function(first.lanes[3], second.lanes[3]) } };
+		}
+#endif
+
+		static Register Multiply2x2(Register first, Register second)
+		{
+			return Add(Multiply(first, Swizzle<0, 3, 0, 3>(second)), Multiply(Swizzle<1, 0, 3, 2>(first), Swizzle<2, 1, 2, 1>(second)));
+		}
+
+		static Register AdjugateMultiply2x2(Register first, Register second)
+		{
+			return Subtract(Multiply(Swizzle<3, 3, 0, 0>(first), second), Multiply(Swizzle<1, 1, 2, 2>(first), Swizzle<2, 3, 0, 1>(second)));
+		}
+
+		static Register MultiplyAdjugate2x2(Register first, Register second)
+		{
+			return Subtract(Multiply(first, Swizzle<3, 0, 3, 0>(second)), Multiply(Swizzle<1, 0, 3, 2>(first), Swizzle<2, 1, 2, 1>(second)));
+		}
+
+	};
+}
\ No newline at end of file
@@ -1,52 +1,71 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
-#include <numbers>
-#include <functional>
+#include <vector>
 #include "ECS/Component.hpp"
+#include "ECS/EntityHandle.hpp"
+#include "ECS/ObjectPool.hpp"
 #include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
 #include "Math/Vector.hpp"
 
 using namespace Wasteland::ECS;
 
 namespace Wasteland::Math
 {
-    class Transform final : public Component
+    class TransformHierarchy;
+
+    class Transform final : public Component, public Pooled<Transform>
     {
 
     public:
 
+        static constexpr uint8_t CHANGED_POSITION = 1 << 0;
+        static constexpr uint8_t CHANGED_ROTATION = 1 << 1;
+        static constexpr uint8_t CHANGED_SCALE = 1 << 2;
+
+        static constexpr bool MUTATES_ON_READ = true;
+
+        ~Transform()
+        {
+            DequeueChange();
+
+            if (auto parentPointer = parent.has_value() ? parent.value().lock() : nullptr)
+                std::erase(parentPointer->children, this);
+
+            for (Transform* child : children)
+                child->MarkWorldDirty();
+
+            if (!children.empty())
+                structureVersion.fetch_add(1, std::memory_order_release);
+        }
+
         void Translate(const Vector<float, 3>& translation)
         {
             localPosition += translation;
 
-            for (auto& function : onPositionUpdated)
-                function(localPosition);
+            MarkLocalDirty();
+            MarkChanged(CHANGED_POSITION);
         }
 
         void Rotate(const Vector<float, 3>& rotationDeg)
         {
-            localRotation += rotationDeg;
-
-            for (int i = 0; i < 3; ++i)
-            {
-                localRotation[i] = std::fmod(localRotation[i], 360.0f);
-
-                if (localRotation[i] < 0.0f)
-                    localRotation[i] += 360.0f;
-            }
+            localRotation = Quaternion<float>::Normalize(localRotation * Quaternion<float>::FromEulerAngles(rotationDeg));
 
-            for (auto& function : onRotationUpdated)
-                function(localRotation);
+            MarkLocalDirty();
+            MarkChanged(CHANGED_ROTATION);
         }
 
         void Scale(const Vector<float, 3>& scale)
         {
             localScale += scale;
 
-            for (auto& function : onScaleUpdated)
-                function(localScale);
+            MarkLocalDirty();
+            MarkChanged(CHANGED_SCALE);
         }
 
         Vector<float, 3> GetLocalPosition() const
@@ -58,35 +77,25 @@ namespace Wasteland::Math
         {
             localPosition = value;
 
-            if (!update)
-                return;
+            MarkLocalDirty();
 
-            for (auto& function : onPositionUpdated)
-                function(localPosition);
+            if (update)
+                MarkChanged(CHANGED_POSITION);
         }
 
-        Vector<float, 3> GetLocalRotation() const
+        Quaternion<float> GetLocalRotation() const
         {
             return localRotation;
         }
 
-        void SetLocalRotation(const Vector<float, 3>& value, bool update = true)
+        void SetLocalRotation(const Quaternion<float>& value, bool update = true)
         {
             localRotation = value;
 
-            for (int i = 0; i < 3; ++i)
-            {
-                localRotation[i] = std::fmod(localRotation[i], 360.0f);
-
-                if (localRotation[i] < 0.0f)
-                    localRotation[i] += 360.0f;
-            }
-
-            if (!update)
-                return;
+            MarkLocalDirty();
 
-            for (auto& function : onRotationUpdated)
-                function(localRotation);
+            if (update)
+                MarkChanged(CHANGED_ROTATION);
         }
 
         Vector<float, 3> GetLocalScale() const
@@ -98,23 +107,22 @@ namespace Wasteland::Math
         {
             localScale = value;
 
-            if (!update)
-                return;
+            MarkLocalDirty();
 
-            for (auto& function : onScaleUpdated)
-                function(localScale);
+            if (update)
+                MarkChanged(CHANGED_SCALE);
         }
 
         Vector<float, 3> GetWorldPosition() const
         {
-            auto M = GetModelMatrix();
+            const auto& M = GetModelMatrix();
 
             return { M[3][0], M[3][1], M[3][2] };
         }
 
         Vector<float, 3> GetWorldScale() const
         {
-            auto M = GetModelMatrix();
+            const auto& M = GetModelMatrix();
 
             auto length = [](float x, float y, float z)
                 {
@@ -131,7 +139,7 @@ namespace Wasteland::Math
 
         Vector<float, 3> GetForward() const
         {
-            auto M = GetModelMatrix();
+            const auto& M = GetModelMatrix();
 
             Vector<float, 3> f = { M[2][0], M[2][1], M[2][2] };
 
@@ -140,7 +148,7 @@ namespace Wasteland::Math
 
         Vector<float, 3> GetRight() const
         {
-            auto M = GetModelMatrix();
+            const auto& M = GetModelMatrix();
 
             Vector<float, 3> r = { M[0][0], M[0][1], M[0][2] };
 
@@ -149,62 +157,23 @@ namespace Wasteland::Math
 
         Vector<float, 3> GetUp() const
         {
-            auto M = GetModelMatrix();
+            const auto& M = GetModelMatrix();
 
             Vector<float, 3> u = { M[1][0], M[1][1], M[1][2] };
 
             return Vector<float, 3>::Normalize(u);
         }
 
-        Vector<float, 3> GetWorldRotation() const
-        {
-            auto M = GetModelMatrix();
-
-            Vector<float, 3> sc = GetWorldScale();
-
-            if (std::fabs(sc.x()) > 1e-6f)
-                M[0][0] /= sc.x(); M[0][1] /= sc.x(); M[0][2] /= sc.x();
-
-            if (std::fabs(sc.y()) > 1e-6f)
-                M[1][0] /= sc.y(); M[1][1] /= sc.y(); M[1][2] /= sc.y();
-
-            if (std::fabs(sc.z()) > 1e-6f)
-                M[2][0] /= sc.z(); M[2][1] /= sc.z(); M[2][2] /= sc.z();
-
-
-            float pitch, yaw, roll;
-
-            if (std::fabs(M[0][0]) < 1e-6f && std::fabs(M[1][0]) < 1e-6f)
-            {
-                pitch = std::atan2(-M[2][0], M[2][2]);
-                yaw = 0.0f;
-                roll = std::atan2(-M[1][2], M[1][1]);
-            }
-            else
-            {
-                yaw = std::atan2(M[1][0], M[0][0]);
-                pitch = std::atan2(-M[2][0], std::sqrt(M[2][1] * M[2][1] + M[2][2] * M[2][2]));
-                roll = std::atan2(M[2][1], M[2][2]);
-            }
-
-            const float rad2deg = 180.0f / std::numbers::pi_v<float>;
-
-            return Vector<float, 3>{ pitch* rad2deg, yaw* rad2deg, roll* rad2deg };
-        }
-
-        void AddOnPositionChangedCallback(const std::function<void(Vector<float, 3>)>& function)
+        Quaternion<float> GetWorldRotation() const
         {
-            onPositionUpdated.push_back(function);
-        }
+            auto parentPointer = parent.has_value() ? parent.value().lock() : nullptr;
 
-        void AddOnRotationChangedCallback(const std::function<void(Vector<float, 3>)>& function)
-        {
-            onRotationUpdated.push_back(function);
+            return parentPointer ? parentPointer->GetWorldRotation() * localRotation : localRotation;
         }
 
-        void AddOnScaleChangedCallback(const std::function<void(Vector<float, 3>)>& function)
+        uint8_t GetChangeFlags() const
         {
-            onScaleUpdated.push_back(function);
+            return changeFlags;
         }
 
         std::optional<std::weak_ptr<Transform>> GetParent() const
@@ -214,36 +183,49 @@ namespace Wasteland::Math
 
         void SetParent(std::shared_ptr<Transform> newParent)
         {
+            if (auto parentPointer = parent.has_value() ? parent.value().lock() : nullptr)
+                std::erase(parentPointer->children, this);
+
             if (!newParent)
                 parent = std::nullopt;
             else
+            {
                 parent = std::make_optional<std::weak_ptr<Transform>>(newParent);
+                newParent->children.push_back(this);
+            }
+
+            structureVersion.fetch_add(1, std::memory_order_release);
+
+            MarkWorldDirty();
         }
 
-        Matrix<float, 4, 4> GetModelMatrix() const
+        const Matrix<float, 4, 4>& GetLocalMatrix() const
         {
-            auto T = Matrix<float, 4, 4>::Translation(localPosition);
-            auto RX = Matrix<float, 4, 4>::RotationX(localRotation.x() * (std::numbers::pi_v<float> / 180.0f));
-            auto RY = Matrix<float, 4, 4>::RotationY(localRotation.y() * (std::numbers::pi_v<float> / 180.0f));
-            auto RZ = Matrix<float, 4, 4>::RotationZ(localRotation.z() * (std::numbers::pi_v<float> / 180.0f));
-            auto S = Matrix<float, 4, 4>::Scale(localScale);
+            if (isLocalDirty)
+            {
+                localMatrix = Matrix<float, 4, 4>::TranslationRotationScale(localPosition, localRotation, localScale);
+                isLocalDirty = false;
+            }
 
-            Matrix<float, 4, 4> localMatrix = T * RZ * RY * RX * S;
+            return localMatrix;
+        }
 
-            if (parent.has_value())
+        const Matrix<float, 4, 4>& GetModelMatrix() const
+        {
+            if (isWorldDirty)
             {
-                auto parentPtr = parent.value().lock();
+                auto parentPointer = parent.has_value() ? parent.value().lock() : nullptr;
 
-                if (parentPtr)
-                    return parentPtr->GetModelMatrix() * localMatrix;
+                worldMatrix = parentPointer ? parentPointer->GetModelMatrix() * GetLocalMatrix() : GetLocalMatrix();
+                isWorldDirty = false;
             }
 
-            return localMatrix;
+            return worldMatrix;
         }
 
-        static std::shared_ptr<Transform> Create(const Vector<float, 3>& position, const Vector<float, 3>& rotation, const Vector<float, 3>& scale)
+        static std::shared_ptr<Transform> Create(const Vector<float, 3>& position, const Quaternion<float>& rotation, const Vector<float, 3>& scale)
         {
-            std::shared_ptr<Transform> result(new Transform());
+            std::shared_ptr<Transform> result = MakePooledShared(new Transform());
 
             result->localPosition = position;
             result->localRotation = rotation;
@@ -256,15 +238,105 @@ namespace Wasteland::Math
 
         Transform() = default;
 
+        void MarkLocalDirty()
+        {
+            isLocalDirty = true;
+
+            MarkWorldDirty();
+        }
+
+        void MarkWorldDirty()
+        {
+            if (isWorldDirty)
+                return;
+
+            isWorldDirty = true;
+
+            if (children.empty())
+                return;
+
+            std::vector<Transform*> pending(children.begin(), children.end());
+
+            while (!pending.empty())
+            {
+                Transform* transform = pending.back();
+
+                pending.pop_back();
+
+                if (transform->isWorldDirty)
+                    continue;
+
+                transform->isWorldDirty = true;
+
+                pending.insert(pending.end(), transform->children.begin(), transform->children.end());
+            }
+        }
+
+        void MarkChanged(uint8_t flags)
+        {
+            bool isFirstChange = changeFlags == 0;
+
+            changeFlags |= flags;
+
+            if (isFirstChange && hierarchySlot != NO_SLOT)
+                EnqueueChange();
+        }
+
+        void EnqueueChange()
+        {
+            std::lock_guard<std::mutex> lock(changedMutex);
+
+            if (changeSlot != NO_SLOT)
+                return;
+
+            changeSlot = static_cast<uint32_t>(changedTransforms.size());
+
+            changedTransforms.push_back(this);
+        }
+
+        void DequeueChange()
+        {
+            if (changeSlot == NO_SLOT)
+                return;
+
+            std::lock_guard<std::mutex> lock(changedMutex);
+
+            changedTransforms[changeSlot] = nullptr;
+            changeSlot = NO_SLOT;
+        }
+
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
         std::optional<std::weak_ptr<Transform>> parent;
+        std::vector<Transform*> children;
+
+        uint32_t hierarchySlot = NO_SLOT;
+        EntityIndex entity = NO_ENTITY;
 
-        std::vector<std::function<void(Vector<float, 3>)>> onPositionUpdated;
-        std::vector<std::function<void(Vector<float, 3>)>> onRotationUpdated;
-        std::vector<std::function<void(Vector<float, 3>)>> onScaleUpdated;
+        uint32_t changeSlot = NO_SLOT;
+        uint8_t changeFlags = 0;
 
         Vector<float, 3> localPosition = { 0.0f, 0.0f, 0.0f };
-        Vector<float, 3> localRotation = { 0.0f, 0.0f, 0.0f };
+        Quaternion<float> localRotation;
         Vector<float, 3> localScale = { 1.0f, 1.0f, 1.0f };
+
+        mutable Matrix<float, 4, 4> localMatrix;
+        mutable Matrix<float, 4, 4> worldMatrix;
+
+        mutable bool isLocalDirty = true;
+        mutable bool isWorldDirty = true;
+
+        static std::atomic<uint32_t> structureVersion;
+
+        static std::mutex changedMutex;
+        static std::vector<Transform*> changedTransforms;
+
+        friend class TransformHierarchy;
     };
 
+    std::atomic<uint32_t> Transform::structureVersion = 0;
+
+    std::mutex Transform::changedMutex;
+    std::vector<Transform*> Transform::changedTransforms;
+
 }
\ No newline at end of file
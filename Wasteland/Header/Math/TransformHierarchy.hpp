@@ -0,0 +1,237 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+#include "Math/Transform.hpp"
+#include "Thread/JobSystem.hpp"
+
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Math
+{
+    struct TransformChange
+    {
+        Transform* transform = nullptr;
+        EntityIndex entity = NO_ENTITY;
+        uint8_t flags = 0;
+    };
+
+    class TransformHierarchy final
+    {
+
+    public:
+
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy(TransformHierarchy&&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(TransformHierarchy&&) = delete;
+
+        void Register(Transform* transform, EntityIndex entity)
+        {
+            if (transform->hierarchySlot != Transform::NO_SLOT)
+                return;
+
+            transform->hierarchySlot = static_cast<uint32_t>(members.size());
+            transform->entity = entity;
+
+            members.push_back(transform);
+
+            if (transform->changeFlags != 0)
+                transform->EnqueueChange();
+
+            isDirty = true;
+        }
+
+        void Unregister(Transform* transform)
+        {
+            uint32_t slot = transform->hierarchySlot;
+
+            if (slot == Transform::NO_SLOT)
+                return;
+
+            members[slot] = members.back();
+            members[slot]->hierarchySlot = slot;
+            members.pop_back();
+
+            transform->DequeueChange();
+
+            transform->hierarchySlot = Transform::NO_SLOT;
+            transform->entity = NO_ENTITY;
+
+            isDirty = true;
+        }
+
+        void Update()
+        {
+            uint32_t version = Transform::structureVersion.load(std::memory_order_acquire);
+
+            if (isDirty || version != builtVersion)
+            {
+                Rebuild();
+
+                builtVersion = version;
+                isDirty = false;
+            }
+
+            if (order.size() < parallelThreshold)
+                UpdateRange(0, order.size());
+            else
+            {
+                JobSystem::GetInstance().ParallelFor(0, roots.size(), ROOT_GRAIN_SIZE, [&](size_t i)
+                {
+                    UpdateRange(roots[i], i + 1 < roots.size() ? roots[i + 1] : order.size());
+                });
+            }
+
+            CollectChanges();
+
+            if (changes.empty())
+                return;
+
+            for (const auto& consumer : consumers)
+                consumer(changes);
+        }
+
+        void AddConsumer(const std::function<void(std::span<const TransformChange>)>& consumer)
+        {
+            consumers.push_back(consumer);
+        }
+
+        std::span<const TransformChange> GetChanges() const
+        {
+            return changes;
+        }
+
+        size_t GetSize() const
+        {
+            return order.size();
+        }
+
+        void SetParallelThreshold(size_t threshold)
+        {
+            parallelThreshold = threshold;
+        }
+
+        size_t GetParallelThreshold() const
+        {
+            return parallelThreshold;
+        }
+
+        static TransformHierarchy& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<TransformHierarchy>(new TransformHierarchy());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+        static constexpr size_t DEFAULT_PARALLEL_THRESHOLD = 4096;
+        static constexpr size_t ROOT_GRAIN_SIZE = 16;
+
+        TransformHierarchy() = default;
+
+        void Rebuild()
+        {
+            order.clear();
+            parents.clear();
+            roots.clear();
+
+            std::vector<std::pair<Transform*, uint32_t>> stack;
+
+            for (Transform* transform : members)
+            {
+                auto parent = transform->parent.has_value() ? transform->parent.value().lock() : nullptr;
+
+                if (parent && parent->hierarchySlot != Transform::NO_SLOT)
+                    continue;
+
+                roots.push_back(static_cast<uint32_t>(order.size()));
+
+                stack.push_back({ transform, NO_PARENT });
+
+                while (!stack.empty())
+                {
+                    auto [node, parentIndex] = stack.back();
+
+                    stack.pop_back();
+
+                    uint32_t index = static_cast<uint32_t>(order.size());
+
+                    order.push_back(node);
+                    parents.push_back(parentIndex);
+
+                    for (auto child = node->children.rbegin(); child != node->children.rend(); ++child)
+                    {
+                        if ((*child)->hierarchySlot != Transform::NO_SLOT)
+                            stack.push_back({ *child, index });
+                    }
+                }
+            }
+        }
+
+        void UpdateRange(size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                Transform* transform = order[i];
+
+                if (!transform->isWorldDirty)
+                    continue;
+
+                transform->worldMatrix = parents[i] == NO_PARENT ? transform->GetLocalMatrix() : order[parents[i]]->worldMatrix * transform->GetLocalMatrix();
+                transform->isWorldDirty = false;
+            }
+        }
+
+        void CollectChanges()
+        {
+            changes.clear();
+
+            std::lock_guard<std::mutex> lock(Transform::changedMutex);
+
+            for (Transform* transform : Transform::changedTransforms)
+            {
+                if (!transform)
+                    continue;
+
+                changes.push_back({ transform, transform->entity, transform->changeFlags });
+
+                transform->changeFlags = 0;
+                transform->changeSlot = Transform::NO_SLOT;
+            }
+
+            Transform::changedTransforms.clear();
+        }
+
+        std::vector<Transform*> members;
+
+        std::vector<Transform*> order;
+        std::vector<uint32_t> parents;
+        std::vector<uint32_t> roots;
+
+        std::vector<TransformChange> changes;
+        std::vector<std::function<void(std::span<const TransformChange>)>> consumers;
+
+        size_t parallelThreshold = DEFAULT_PARALLEL_THRESHOLD;
+
+        uint32_t builtVersion = 0;
+        bool isDirty = false;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<TransformHierarchy> instance;
+
+    };
+
+    std::once_flag TransformHierarchy::initializationFlag;
+    std::unique_ptr<TransformHierarchy> TransformHierarchy::instance;
+}
\ No newline at end of file
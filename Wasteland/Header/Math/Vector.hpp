@@ -7,10 +7,12 @@
 #include <concepts>
 #include <format>
 #include <functional>
-#include <initializer_list>
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <span>
+#include "Math/ConstexprMath.hpp"
+#include "Math/Simd.hpp"
 #include <cereal/cereal.hpp>
 #include <cereal/types/array.hpp>
 #include <cereal/types/vector.hpp>
@@ -38,6 +40,18 @@ namespace Wasteland::Math
 		{ a.end() } -> std::input_or_output_iterator;
 	};
 
+	template <Arithmetic T, size_t N>
+	class Vector;
+
+	template <typename Container>
+	inline constexpr size_t STATIC_SIZE = std::dynamic_extent;
+
+	template <typename T, size_t N>
+	inline constexpr size_t STATIC_SIZE<std::array<T, N>> = N;
+
+	template <typename T, size_t N>
+	inline constexpr size_t STATIC_SIZE<Vector<T, N>> = N;
+
 	template <Arithmetic T, size_t N>
 	class Vector final
 	{
@@ -48,89 +62,78 @@ namespace Wasteland::Math
 		
 		Vector() = default;
 
-		Vector(std::initializer_list<T> input)
-		{
-			assert(input.size() == N);
-			std::copy(input.begin(), input.end(), data.begin());
-		}
+		template <typename... Args> requires (sizeof...(Args) == N && (std::convertible_to<Args, T> && ...))
+		constexpr Vector(Args... input) : data{ static_cast<T>(input)... } { }
 
 		template <ArrayType U>
-		Vector(const U& input)
+		constexpr Vector(const U& input)
 		{
-			assert(std::distance(input.begin(), input.end()) == N);
+			CheckSize(input);
 			std::copy(input.begin(), input.end(), data.begin());
 		}
 
-		bool operator==(const Vector& operand) const
+		constexpr bool operator==(const Vector& operand) const
 		{
 			return data == operand.data;
 		}
 
-		bool operator!=(const Vector& operand) const
+		constexpr bool operator!=(const Vector& operand) const
 		{
 			return !(*this == operand);
 		}
 
 		template <ArrayType U>
-		bool operator==(const U& operand) const
+		constexpr bool operator==(const U& operand) const
 		{
-			if (std::distance(operand.begin(), operand.end()) != N)
+			if constexpr (STATIC_SIZE<U> != std::dynamic_extent)
+			{
+				if constexpr (STATIC_SIZE<U> != N)
+					return false;
+			}
+			else if (std::distance(operand.begin(), operand.end()) != N)
 				return false;
 				
 			return std::equal(data.begin(), data.end(), operand.begin());
 		}
 
 		template <ArrayType U>
-		bool operator!=(const U& operand) const
-		{
-			return !(*this == operand);
-		}
-
-		bool operator==(std::initializer_list<T> operand) const
-		{
-			if (operand.size() != N)
-				return false;
-
-			return std::equal(data.begin(), data.end(), operand.begin());
-		}
-
-		bool operator!=(std::initializer_list<T> operand) const
+		constexpr bool operator!=(const U& operand) const
 		{
 			return !(*this == operand);
 		}
 
 		template <ArrayType U>
-		Vector& operator=(const U& operand)
+		constexpr Vector& operator=(const U& operand)
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
+			CheckSize(operand);
 			std::copy(operand.begin(), operand.end(), data.begin());
 
 			return *this;
 		}
 
-		Vector& operator=(std::initializer_list<T> operand)
+		constexpr Vector operator+(const Vector& operand) const
 		{
-			assert(operand.size() == N);
-			std::copy(operand.begin(), operand.end(), data.begin());
-
-			return *this;
-		}
+			Vector result;
 
-		template <ArrayType U>
-		Vector operator+(const U& operand) const
-		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Add(Simd::Load(data.data()), Simd::Load(operand.data.data())));
 
-			Vector result;
+					return result;
+				}
+			}
 
-			std::transform(data.begin(), data.end(), operand.begin(), result.data.begin(), std::plus<T>());
+			std::transform(data.begin(), data.end(), operand.data.begin(), result.data.begin(), std::plus<T>());
 
 			return result;
 		}
 
-		Vector operator+(std::initializer_list<T> operand) const
+		template <ArrayType U>
+		constexpr Vector operator+(const U& operand) const
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			Vector result;
 
@@ -139,30 +142,48 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		Vector operator+(T operand) const
+		constexpr Vector operator+(T operand) const
 		{
 			Vector result;
 
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Add(Simd::Load(data.data()), Simd::Splat(operand)));
+
+					return result;
+				}
+			}
+
 			std::transform(data.begin(), data.end(), result.data.begin(), [&](const T& value) { return value + operand; });
 
 			return result;
 		}
 
-		template <ArrayType U>
-		Vector operator-(const U& operand) const
+		constexpr Vector operator-(const Vector& operand) const
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
-
 			Vector result;
 
-			std::transform(data.begin(), data.end(), operand.begin(), result.data.begin(), std::minus<T>());
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Subtract(Simd::Load(data.data()), Simd::Load(operand.data.data())));
+
+					return result;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), result.data.begin(), std::minus<T>());
 
 			return result;
 		}
 
-		Vector operator-(std::initializer_list<T> operand) const
+		template <ArrayType U>
+		constexpr Vector operator-(const U& operand) const
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			Vector result;
 
@@ -171,30 +192,48 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		Vector operator-(T operand) const
+		constexpr Vector operator-(T operand) const
 		{
 			Vector result;
 
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Subtract(Simd::Load(data.data()), Simd::Splat(operand)));
+
+					return result;
+				}
+			}
+
 			std::transform(data.begin(), data.end(), result.data.begin(), [&](const T& value) { return value - operand; });
 
 			return result;
 		}
 
-		template <ArrayType U>
-		Vector operator*(const U& operand) const
+		constexpr Vector operator*(const Vector& operand) const
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
-
 			Vector result;
 
-			std::transform(data.begin(), data.end(), operand.begin(), result.data.begin(), std::multiplies<T>());
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Multiply(Simd::Load(data.data()), Simd::Load(operand.data.data())));
+
+					return result;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), result.data.begin(), std::multiplies<T>());
 
 			return result;
 		}
 
-		Vector operator*(std::initializer_list<T> operand) const
+		template <ArrayType U>
+		constexpr Vector operator*(const U& operand) const
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			Vector result;
 
@@ -203,30 +242,48 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		Vector operator*(T operand) const
+		constexpr Vector operator*(T operand) const
 		{
 			Vector result;
 
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Multiply(Simd::Load(data.data()), Simd::Splat(operand)));
+
+					return result;
+				}
+			}
+
 			std::transform(data.begin(), data.end(), result.data.begin(), [&](const T& value) { return value * operand; });
 
 			return result;
 		}
 
-		template <ArrayType U>
-		Vector operator/(const U& operand) const
+		constexpr Vector operator/(const Vector& operand) const
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
-
 			Vector result;
 
-			std::transform(data.begin(), data.end(), operand.begin(), result.data.begin(), std::divides<T>());
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Divide(Simd::Load(data.data()), Simd::Load(operand.data.data())));
+
+					return result;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), result.data.begin(), std::divides<T>());
 
 			return result;
 		}
 
-		Vector operator/(std::initializer_list<T> operand) const
+		template <ArrayType U>
+		constexpr Vector operator/(const U& operand) const
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			Vector result;
 
@@ -235,258 +292,310 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		Vector operator/(T operand) const
+		constexpr Vector operator/(T operand) const
 		{
 			Vector result;
 
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Divide(Simd::Load(data.data()), Simd::Splat(operand)));
+
+					return result;
+				}
+			}
+
 			std::transform(data.begin(), data.end(), result.data.begin(), [&](const T& value) { return value / operand; });
 
 			return result;
 		}
 
-		template <ArrayType U>
-		Vector& operator+=(const U& operand)
+		constexpr Vector& operator+=(const Vector& operand)
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(data.data(), Simd::Add(Simd::Load(data.data()), Simd::Load(operand.data.data())));
 
-			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::plus<T>());
+					return *this;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), data.begin(), std::plus<T>());
 
 			return *this;
 		}
 
-		Vector& operator+=(std::initializer_list<T> operand)
+		template <ArrayType U>
+		constexpr Vector& operator+=(const U& operand)
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::plus<T>());
 
 			return *this;
 		}
 
-		Vector& operator+=(T operand)
+		constexpr Vector& operator+=(T operand)
 		{
 			std::for_each(data.begin(), data.end(), [&](T& value) { value += operand; });
 
 			return *this;
 		}
 
-		template <ArrayType U>
-		Vector& operator-=(const U& operand)
+		constexpr Vector& operator-=(const Vector& operand)
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(data.data(), Simd::Subtract(Simd::Load(data.data()), Simd::Load(operand.data.data())));
 
-			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::minus<T>());
+					return *this;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), data.begin(), std::minus<T>());
 
 			return *this;
 		}
 
-		Vector& operator-=(std::initializer_list<T> operand)
+		template <ArrayType U>
+		constexpr Vector& operator-=(const U& operand)
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::minus<T>());
 
 			return *this;
 		}
 
-		Vector& operator-=(T operand)
+		constexpr Vector& operator-=(T operand)
 		{
 			std::for_each(data.begin(), data.end(), [&](T& value) { value -= operand; });
 			return *this;
 		}
 
-		template <ArrayType U>
-		Vector& operator*=(const U& operand)
+		constexpr Vector& operator*=(const Vector& operand)
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(data.data(), Simd::Multiply(Simd::Load(data.data()), Simd::Load(operand.data.data())));
 
-			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::multiplies<T>());
+					return *this;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), data.begin(), std::multiplies<T>());
 
 			return *this;
 		}
 
-		Vector& operator*=(std::initializer_list<T> operand)
+		template <ArrayType U>
+		constexpr Vector& operator*=(const U& operand)
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::multiplies<T>());
 
 			return *this;
 		}
 
-		Vector& operator*=(T operand)
+		constexpr Vector& operator*=(T operand)
 		{
 			std::for_each(data.begin(), data.end(), [&](T& value) { value *= operand; });
 
 			return *this;
 		}
 
-		template <ArrayType U>
-		Vector& operator/=(const U& operand)
+		constexpr Vector& operator/=(const Vector& operand)
 		{
-			assert(std::distance(operand.begin(), operand.end()) == N);
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(data.data(), Simd::Divide(Simd::Load(data.data()), Simd::Load(operand.data.data())));
 
-			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::divides<T>());
+					return *this;
+				}
+			}
+
+			std::transform(data.begin(), data.end(), operand.data.begin(), data.begin(), std::divides<T>());
 
 			return *this;
 		}
 
-		Vector& operator/=(std::initializer_list<T> operand)
+		template <ArrayType U>
+		constexpr Vector& operator/=(const U& operand)
 		{
-			assert(operand.size() == N);
+			CheckSize(operand);
 
 			std::transform(data.begin(), data.end(), operand.begin(), data.begin(), std::divides<T>());
 
 			return *this;
 		}
 
-		Vector& operator/=(T operand)
+		constexpr Vector& operator/=(T operand)
 		{
 			std::for_each(data.begin(), data.end(), [&](T& value) { value /= operand; });
 			return *this;
 		}
 
-		T operator[](size_t operand) const
+		constexpr T operator[](size_t operand) const
 		{
 			return data.at(operand);
 		}
 
-		T& operator[](size_t operand)
+		constexpr T& operator[](size_t operand)
 		{
 			return data[operand];
 		}
 
-		T& x() requires (N > 0)
+		constexpr T& x() requires (N > 0)
 		{
 			return data[0];
 		}
 
-		T x() const requires (N > 0)
+		constexpr T x() const requires (N > 0)
 		{
 			return data[0];
 		}
 
-		T& y() requires (N > 1)
+		constexpr T& y() requires (N > 1)
 		{
 			return data[1];
 		}
 
-		T y() const requires (N > 1)
+		constexpr T y() const requires (N > 1)
 		{
 			return data[1];
 		}
 
-		T& z() requires (N > 2)
+		constexpr T& z() requires (N > 2)
 		{
 			return data[2];
 		}
 
-		T z() const requires (N > 2)
+		constexpr T z() const requires (N > 2)
 		{
 			return data[2];
 		}
 
-		T& w() requires (N > 3)
+		constexpr T& w() requires (N > 3)
 		{
 			return data[3];
 		}
 
-		T w() const requires (N > 3)
+		constexpr T w() const requires (N > 3)
 		{
 			return data[3];
 		}
 
-		T& a() requires (N > 4)
+		constexpr T& a() requires (N > 4)
 		{
 			return data[4];
 		}
 
-		T a() const requires (N > 4)
+		constexpr T a() const requires (N > 4)
 		{
 			return data[4];
 		}
 
-		T& b() requires (N > 5)
+		constexpr T& b() requires (N > 5)
 		{
 			return data[5];
 		}
 
-		T b() const requires (N > 5)
+		constexpr T b() const requires (N > 5)
 		{
 			return data[5];
 		}
 
-		T& c() requires (N > 6)
+		constexpr T& c() requires (N > 6)
 		{
 			return data[6];
 		}
 
-		T c() const requires (N > 6)
+		constexpr T c() const requires (N > 6)
 		{
 			return data[6];
 		}
 
-		T& d() requires (N > 7)
+		constexpr T& d() requires (N > 7)
 		{
 			return data[7];
 		}
 
-		T d() const requires (N > 7)
+		constexpr T d() const requires (N > 7)
 		{
 			return data[7];
 		}
 
-		T& e() requires (N > 8)
+		constexpr T& e() requires (N > 8)
 		{
 			return data[8];
 		}
 
-		T e() const requires (N > 8)
+		constexpr T e() const requires (N > 8)
 		{
 			return data[8];
 		}
 
-		T& f() requires (N > 9)
+		constexpr T& f() requires (N > 9)
 		{
 			return data[9];
 		}
 
-		T f() const requires (N > 9)
+		constexpr T f() const requires (N > 9)
 		{
 			return data[9];
 		}
 
-		auto begin()
+		constexpr T* Data()
+		{
+			return data.data();
+		}
+
+		constexpr const T* Data() const
+		{
+			return data.data();
+		}
+
+		constexpr auto begin()
 		{
 			return data.begin();
 		}
 
-		auto end()
+		constexpr auto end()
 		{
 			return data.end();
 		}
 
-		auto begin() const
+		constexpr auto begin() const
 		{
 			return data.begin();
 		}
 
-		auto end() const
+		constexpr auto end() const
 		{
 			return data.end();
 		}
 
-		constexpr size_t Length()
+		static constexpr size_t Length()
 		{
 			return N;
 		}
 
-		static T Magnitude(const Vector& first)
+		static constexpr T Magnitude(const Vector& first)
 		{
-			return std::sqrt(std::inner_product(first.data.begin(), first.data.end(), first.data.begin(), T(0)));
+			return ConstexprMath::Sqrt(Dot(first, first));
 		}
 
-		static Vector Normalize(const Vector& first)
+		static constexpr Vector Normalize(const Vector& first)
 		{
 			T magnitude = Magnitude(first);
 
@@ -495,13 +604,31 @@ namespace Wasteland::Math
 
 			Vector result;
 
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					Simd::Store(result.data.data(), Simd::Divide(Simd::Load(first.data.data()), Simd::Splat(magnitude)));
+
+					return result;
+				}
+			}
+
 			std::transform(first.data.begin(), first.data.end(), result.data.begin(), [&](T value) { return value / magnitude; });
 
 			return result;
 		}
 
-		static T Dot(const Vector& first, const Vector& second)
+		static constexpr T Dot(const Vector& first, const Vector& second)
 		{
+			if constexpr (IS_SIMD)
+			{
+				if !consteval
+				{
+					return Simd::Dot(Simd::Load(first.data.data()), Simd::Load(second.data.data()));
+				}
+			}
+
 			return std::inner_product(first.data.begin(), first.data.end(), second.data.begin(), T(0));
 		}
 
@@ -516,7 +643,7 @@ namespace Wasteland::Math
 			return std::acos(dotProduct / magnitudeProduct);
 		}
 
-		static Vector Cross(const Vector& first, const Vector& second) requires (N == 3)
+		static constexpr Vector Cross(const Vector& first, const Vector& second) requires (N == 3)
 		{
 			Vector result;
 
@@ -527,7 +654,7 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		static Vector Project(const Vector& first, const Vector& second)
+		static constexpr Vector Project(const Vector& first, const Vector& second)
 		{
 			T dotProduct = Dot(first, second);
 			T magnitudeSquared = Dot(second, second);
@@ -542,7 +669,7 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		static Vector Reflect(const Vector& first, const Vector& normal)
+		static constexpr Vector Reflect(const Vector& first, const Vector& normal)
 		{
 			Vector normalizedNormal = Normalize(normal);
 
@@ -557,7 +684,7 @@ namespace Wasteland::Math
 			return result;
 		}
 
-		static Vector Lerp(const Vector& first, const Vector& second, T t)
+		static constexpr Vector Lerp(const Vector& first, const Vector& second, T t)
 		{
 			Vector result;
 
@@ -573,7 +700,7 @@ namespace Wasteland::Math
 		}
 
 		template <ArrayType U>
-		operator U() const
+		constexpr operator U() const
 		{
 			U result;
 
@@ -593,7 +720,18 @@ namespace Wasteland::Math
 
 	private:
 
-		std::array<T, N> data;
+		template <ArrayType U>
+		static constexpr void CheckSize(const U& input)
+		{
+			if constexpr (STATIC_SIZE<U> != std::dynamic_extent)
+				static_assert(STATIC_SIZE<U> == N, "Operand size must match the vector size");
+			else
+				assert(std::distance(input.begin(), input.end()) == N);
+		}
+
+		static constexpr bool IS_SIMD = std::same_as<T, float> && N == 4;
+
+		alignas(IS_SIMD ? 16 : alignof(T)) std::array<T, N> data;
 
 	};
 
@@ -614,6 +752,12 @@ namespace Wasteland::Math
 
 		return os;
 	}
+
+	static_assert(Vector<float, 3>{ 1.0f, 2.0f, 3.0f } + Vector<float, 3>{ 1.0f, 1.0f, 1.0f } == Vector<float, 3>{ 2.0f, 3.0f, 4.0f });
+	static_assert(Vector<float, 3>::Cross({ 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }) == Vector<float, 3>{ 0.0f, 0.0f, 1.0f });
+	static_assert(Vector<float, 4>::Dot({ 1.0f, 2.0f, 3.0f, 4.0f }, { 1.0f, 2.0f, 3.0f, 4.0f }) == 30.0f);
+	static_assert(Vector<float, 3>::Magnitude({ 0.0f, 3.0f, 4.0f }) == 5.0f);
+	static_assert(Vector<int, 3>{ 1, 2, 3 } * 2 == Vector<int, 3>{ 2, 4, 6 });
 }
 
 namespace std
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <numbers>
 #include "Core/Window.hpp"
 #include "ECS/GameObject.hpp"
@@ -11,23 +13,58 @@ using namespace Wasteland::Math;
 
 namespace Wasteland::Render
 {
+	struct CameraData
+	{
+		Matrix<float, 4, 4> view = Matrix<float, 4, 4>::Identity();
+		Matrix<float, 4, 4> projection = Matrix<float, 4, 4>::Identity();
+		Matrix<float, 4, 4> viewProjection = Matrix<float, 4, 4>::Identity();
+
+		std::array<Vector<float, 4>, 6> frustumPlanes = { };
+
+		Vector<float, 3> position = { 0.0f, 0.0f, 0.0f };
+	};
+
 	class Camera : public Component
 	{
 
 	public:
 
+		void UpdateData()
+		{
+			Vector<int, 2> dimensions = Window::GetInstance().GetDimensions();
+
+			float aspectRatio = dimensions.y() > 0 ? static_cast<float>(dimensions.x()) / static_cast<float>(dimensions.y()) : cachedAspectRatio;
+
+			if (!hasProjection || aspectRatio != cachedAspectRatio)
+			{
+				data.projection = Matrix<float, 4, 4>::Perspective(fieldOfView * (std::numbers::pi_v<float> / 180.0f), aspectRatio, nearPlane, farPlane);
+
+				cachedAspectRatio = aspectRatio;
+				hasProjection = true;
+			}
+
+			const Matrix<float, 4, 4>& world = transform->GetModelMatrix();
+
+			data.view = VIEW_BASIS * Matrix<float, 4, 4>::InverseRigid(world);
+			data.position = { world[3][0], world[3][1], world[3][2] };
+			data.viewProjection = data.projection * data.view;
+
+			ExtractFrustumPlanes();
+		}
+
+		const CameraData& GetData() const
+		{
+			return data;
+		}
+
 		Matrix<float, 4, 4> GetProjectionMatrix() const
 		{
-			return Matrix<float, 4, 4>::Perspective(fieldOfView * (std::numbers::pi / 180), (float) Window::GetInstance().GetDimensions().x() / (float) Window::GetInstance().GetDimensions().y(), nearPlane, farPlane);
+			return data.projection;
 		}
 
 		Matrix<float, 4, 4> GetViewMatrix() const
 		{
-			Vector<float, 3> position = Super::GetGameObject()->GetTransform()->GetWorldPosition();
-			Vector<float, 3> forward = Super::GetGameObject()->GetTransform()->GetForward();
-			Vector<float, 3> up = { 0.0f, 1.0f, 0.0f };
-
-			return Matrix<float, 4, 4>::LookAt(position, position + forward, up);
+			return data.view;
 		}
 		
 		static std::shared_ptr<Camera> Create(float fieldOfView, float nearPlane, float farPlane)
@@ -43,11 +80,39 @@ namespace Wasteland::Render
 
 	private:
 
+		static constexpr Matrix<float, 4, 4> VIEW_BASIS = Matrix<float, 4, 4>::Scale({ -1.0f, 1.0f, -1.0f });
+
 		Camera() = default;
 
+		void ExtractFrustumPlanes()
+		{
+			const Matrix<float, 4, 4>& m = data.viewProjection;
+
+			for (size_t i = 0; i < 3; ++i)
+			{
+				for (size_t side = 0; side < 2; ++side)
+				{
+					float sign = side == 0 ? 1.0f : -1.0f;
+
+					Vector<float, 4> plane = { m[0][3] + sign * m[0][i], m[1][3] + sign * m[1][i], m[2][3] + sign * m[2][i], m[3][3] + sign * m[3][i] };
+
+					float length = std::sqrt(plane.x() * plane.x() + plane.y() * plane.y() + plane.z() * plane.z());
+
+					data.frustumPlanes[i * 2 + side] = length > 0.0f ? plane / length : plane;
+				}
+			}
+		}
+
 		float fieldOfView;
 		float nearPlane;
 		float farPlane;
 
+		CameraData data;
+
+		float cachedAspectRatio = 1.0f;
+		bool hasProjection = false;
+
+		Dependency<Transform> transform{ this };
+
 	};
 }
\ No newline at end of file
@@ -1,96 +1,43 @@
 #pragma once
 
-#include <atomic>
 #include <vector>
 #include "ECS/GameObject.hpp"
+#include "ECS/ObjectPool.hpp"
 #include "Math/Transform.hpp"
-#include "Render/Camera.hpp"
-#include "Render/Shader.hpp"
-#include "Render/Texture.hpp"
+#include "Render/RenderSnapshot.hpp"
+#include "Render/UploadThread.hpp"
 #include "Render/Vertex.hpp"
-#include "Utility/Exception/Exceptions/GraphicalErrorException.hpp"
+#include "Utility/Exception/Exceptions/IllegalStateException.hpp"
 
 namespace Wasteland::Render
 {
-	class Mesh final : public Component
+	class Mesh final : public Component, public Pooled<Mesh>
 	{
 
 	public:
 
-		~Mesh()
-		{
-			glDeleteVertexArrays(1, &VAO);
-			glDeleteBuffers(1, &VBO);
-			glDeleteBuffers(1, &EBO);
-		}
-
 		Mesh(const Mesh&) = delete;
 		Mesh(Mesh&&) = delete;
 
 		void Generate()
 		{
-			isInitialized = false;
-
 			if (vertices.size() <= 0 || indices.size() <= 0)
 				throw MAKE_EXCEPTION(IllegalStateException, "Vertices and/or indices was 0 for mesh '" + Super::GetGameObject()->GetName() + "'!");
 
-			glGenVertexArrays(1, &VAO);
-			glGenBuffers(1, &VBO);
-			glGenBuffers(1, &EBO);
-
-			glBindVertexArray(VAO);
-
-			glBindBuffer(GL_ARRAY_BUFFER, VBO);
-			glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
-
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-			glEnableVertexAttribArray(0);
-
-			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
-			glEnableVertexAttribArray(1);
-
-			glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-			glEnableVertexAttribArray(2);
+			buffers = std::allocate_shared<MeshBuffers>(PoolAllocator<MeshBuffers>());
 
-			glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uvs));
-			glEnableVertexAttribArray(3);
-
-			glBindVertexArray(0);
-
-			isInitialized = true;
+			UploadThread::GetInstance().Enqueue([buffers = buffers, vertices = vertices, indices = indices]()
+			{
+				buffers->Upload(vertices, indices);
+			});
 		}
 
-		void Render(std::shared_ptr<Camera> camera) override
+		void Render(RenderSnapshot& snapshot) override
 		{
-			if (!isInitialized)
+			if (!buffers->isUploaded.load(std::memory_order_acquire) || !shader || !texture)
 				return;
 
-			auto shader = Super::GetGameObject()->GetComponent<Shader>().value();
-			auto texture = Super::GetGameObject()->GetComponent<Texture>().value();
-
-			glBindVertexArray(VAO);
-
-			shader->Bind();
-			texture->Bind(0);
-
-			shader->SetUniform("projection", camera->GetProjectionMatrix());
-			shader->SetUniform("view", camera->GetViewMatrix());
-			shader->SetUniform("model", Super::GetGameObject()->GetTransform()->GetModelMatrix());
-
-			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0);
-
-			texture->Unbind();
-			shader->Unbind();
-
-			glBindVertexArray(0);
-
-			int error = glGetError();
-
-			if (error != 0)
-				throw MAKE_EXCEPTION(GraphicalErrorException, std::format("OpenGL Error: '{}' in game object '{}'!", error, Super::GetGameObject()->GetName()));
+			snapshot.items.push_back({ buffers, shader.GetShared(), texture.GetShared(), transform->GetModelMatrix() });
 		}
 
 		void SetVertices(const std::vector<Vertex>& vertices)
@@ -105,7 +52,7 @@ namespace Wasteland::Render
 
 		static std::shared_ptr<Mesh> Create(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
 		{
-			std::shared_ptr<Mesh> result(new Mesh());
+			std::shared_ptr<Mesh> result = MakePooledShared(new Mesh());
 
 			result->vertices = vertices;
 			result->indices = indices;
@@ -120,9 +67,11 @@ namespace Wasteland::Render
 		std::vector<Vertex> vertices;
 		std::vector<unsigned int> indices;
 
-		unsigned int VAO, VBO, EBO;
+		std::shared_ptr<MeshBuffers> buffers = std::allocate_shared<MeshBuffers>(PoolAllocator<MeshBuffers>());
 
-		std::atomic<bool> isInitialized = false;
+		Dependency<Transform> transform{ this };
+		Dependency<Shader> shader{ this };
+		Dependency<Texture> texture{ this };
 
 	};
 }
\ No newline at end of file
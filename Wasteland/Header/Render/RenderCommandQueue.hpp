@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Thread/Job.hpp"
+
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Render
+{
+	class RenderCommandQueue final
+	{
+
+	public:
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue(RenderCommandQueue&&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(RenderCommandQueue&&) = delete;
+
+		void Enqueue(Job command)
+		{
+			if (isDeferred.load(std::memory_order_acquire) && std::this_thread::get_id() != ownerThread)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				if (isDeferred.load(std::memory_order_relaxed))
+				{
+					commands.push_back(std::move(command));
+					return;
+				}
+			}
+
+			command();
+		}
+
+		void ExecutePending()
+		{
+			std::vector<Job> pending;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				pending.swap(commands);
+			}
+
+			for (Job& command : pending)
+				command();
+		}
+
+		void BeginDeferring(std::thread::id owner)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			ownerThread = owner;
+			isDeferred.store(true, std::memory_order_release);
+		}
+
+		void EndDeferring()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				isDeferred.store(false, std::memory_order_release);
+			}
+
+			ExecutePending();
+		}
+
+		static RenderCommandQueue& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<RenderCommandQueue>(new RenderCommandQueue());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		RenderCommandQueue() = default;
+
+		std::mutex mutex;
+		std::vector<Job> commands;
+
+		std::atomic<bool> isDeferred = false;
+		std::thread::id ownerThread;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<RenderCommandQueue> instance;
+
+	};
+
+	std::once_flag RenderCommandQueue::initializationFlag;
+	std::unique_ptr<RenderCommandQueue> RenderCommandQueue::instance;
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <vector>
+#include <glad/glad.h>
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+#include "Render/Camera.hpp"
+#include "Render/RenderCommandQueue.hpp"
+#include "Render/Shader.hpp"
+#include "Render/Texture.hpp"
+#include "Render/UniformBuffers.hpp"
+#include "Render/Vertex.hpp"
+#include "Utility/Exception/Exceptions/GraphicalErrorException.hpp"
+
+using namespace Wasteland::Math;
+using namespace Wasteland::Utility::Exception::Exceptions;
+
+namespace Wasteland::Render
+{
+	struct MeshBuffers
+	{
+		~MeshBuffers()
+		{
+			if (!isUploaded)
+				return;
+
+			RenderCommandQueue::GetInstance().Enqueue([VAO = VAO, VBO = VBO, EBO = EBO, fence = fence]()
+			{
+				if (fence)
+					glDeleteSync(fence);
+
+				if (VAO)
+					glDeleteVertexArrays(1, &VAO);
+
+				glDeleteBuffers(1, &VBO);
+				glDeleteBuffers(1, &EBO);
+			});
+		}
+
+		void Upload(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices)
+		{
+			glGenBuffers(1, &VBO);
+			glGenBuffers(1, &EBO);
+
+			glBindBuffer(GL_ARRAY_BUFFER, VBO);
+			glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+			indexCount = indices.size();
+
+			fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+			glFlush();
+
+			isUploaded.store(true, std::memory_order_release);
+		}
+
+		bool MakeResident()
+		{
+			if (VAO)
+				return true;
+
+			if (!isUploaded.load(std::memory_order_acquire))
+				return false;
+
+			if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+				return false;
+
+			glDeleteSync(fence);
+			fence = nullptr;
+
+			glGenVertexArrays(1, &VAO);
+			glBindVertexArray(VAO);
+
+			glBindBuffer(GL_ARRAY_BUFFER, VBO);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+			glEnableVertexAttribArray(0);
+
+			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+			glEnableVertexAttribArray(1);
+
+			glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+			glEnableVertexAttribArray(2);
+
+			glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uvs));
+			glEnableVertexAttribArray(3);
+
+			glBindVertexArray(0);
+
+			return true;
+		}
+
+		unsigned int VAO = 0;
+		unsigned int VBO = 0;
+		unsigned int EBO = 0;
+
+		size_t indexCount = 0;
+
+		GLsync fence = nullptr;
+
+		std::atomic<bool> isUploaded = false;
+	};
+
+	struct RenderItem
+	{
+		std::shared_ptr<MeshBuffers> buffers;
+
+		std::shared_ptr<Shader> shader;
+		std::shared_ptr<Texture> texture;
+
+		Matrix<float, 4, 4> model;
+	};
+
+	struct RenderSnapshot
+	{
+		CameraData camera;
+
+		float time = 0.0f;
+
+		Vector<int, 2> viewport;
+
+		std::vector<RenderItem> items;
+
+		std::chrono::steady_clock::time_point inputTime;
+
+		void SetCamera(const Camera& source)
+		{
+			camera = source.GetData();
+		}
+
+		void Clear()
+		{
+			items.clear();
+		}
+
+		void Draw() const
+		{
+			glViewport(0, 0, viewport.x(), viewport.y());
+
+			UniformBuffers::GetInstance().BeginFrame(camera, time, items, &RenderItem::model);
+
+			for (size_t i = 0; i < items.size(); ++i)
+			{
+				const RenderItem& item = items[i];
+
+				if (!item.buffers->MakeResident() || !item.texture->MakeResident())
+					continue;
+
+				glBindVertexArray(item.buffers->VAO);
+
+				item.shader->Bind();
+				item.shader->SetUniform(item.shader->GetDiffuseSampler(), Shader::DIFFUSE_TEXTURE_UNIT);
+
+				item.texture->Bind(Shader::DIFFUSE_TEXTURE_UNIT);
+
+				UniformBuffers::GetInstance().BindObject(i);
+
+				glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(item.buffers->indexCount), GL_UNSIGNED_INT, 0);
+
+				item.texture->Unbind();
+				item.shader->Unbind();
+
+				glBindVertexArray(0);
+			}
+
+			UniformBuffers::GetInstance().EndFrame();
+
+			int error = glGetError();
+
+			if (error != 0)
+				throw MAKE_EXCEPTION(GraphicalErrorException, std::format("OpenGL Error: '{}' while drawing {} items!", error, items.size()));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Core/Window.hpp"
+#include "Render/RenderCommandQueue.hpp"
+#include "Render/RenderSnapshot.hpp"
+
+using namespace Wasteland::Core;
+
+namespace Wasteland::Render
+{
+	enum class FrameMode
+	{
+		SEQUENTIAL,
+		PIPELINED
+	};
+
+	struct FrameStatistics
+	{
+		size_t presentedFrames = 0;
+
+		std::chrono::duration<float, std::milli> frameTime = { };
+		std::chrono::duration<float, std::milli> inputLatency = { };
+	};
+
+	class RenderThread final
+	{
+
+	public:
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread(RenderThread&&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+		RenderThread& operator=(RenderThread&&) = delete;
+
+		~RenderThread()
+		{
+			if (!thread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				isStopping = true;
+			}
+
+			condition.notify_all();
+
+			thread.join();
+		}
+
+		void Start()
+		{
+			if (thread.joinable())
+				return;
+
+			isStopping = false;
+
+			Window::GetInstance().ReleaseContext();
+
+			thread = std::thread([this]()
+			{
+				Window::GetInstance().AcquireContext();
+
+				RenderCommandQueue::GetInstance().BeginDeferring(std::this_thread::get_id());
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+
+					isStarted = true;
+				}
+
+				condition.notify_all();
+
+				Run();
+
+				Window::GetInstance().ReleaseContext();
+			});
+
+			std::unique_lock<std::mutex> lock(mutex);
+
+			condition.wait(lock, [this]() { return isStarted; });
+		}
+
+		void Stop()
+		{
+			if (!thread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				isStopping = true;
+			}
+
+			condition.notify_all();
+
+			thread.join();
+
+			isStarted = false;
+
+			Window::GetInstance().AcquireContext();
+
+			RenderCommandQueue::GetInstance().EndDeferring();
+
+			pendingFrame.Clear();
+			hasPendingFrame = false;
+
+			if (exception)
+				std::rethrow_exception(std::exchange(exception, nullptr));
+		}
+
+		FrameMode GetFrameMode() const
+		{
+			return thread.joinable() ? FrameMode::PIPELINED : FrameMode::SEQUENTIAL;
+		}
+
+		void Submit(RenderSnapshot& snapshot)
+		{
+			if (!thread.joinable())
+			{
+				Present(snapshot);
+				return;
+			}
+
+			std::unique_lock<std::mutex> lock(mutex);
+
+			condition.wait(lock, [this]() { return !hasPendingFrame || isStopping; });
+
+			if (exception)
+			{
+				lock.unlock();
+
+				Stop();
+
+				return;
+			}
+
+			std::swap(pendingFrame, snapshot);
+
+			hasPendingFrame = true;
+
+			lock.unlock();
+
+			condition.notify_all();
+		}
+
+		FrameStatistics GetStatistics()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			return statistics;
+		}
+
+		static RenderThread& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<RenderThread>(new RenderThread());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		RenderThread() = default;
+
+		void Run()
+		{
+			RenderSnapshot currentFrame;
+
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+
+					condition.wait(lock, [this]() { return hasPendingFrame || isStopping; });
+
+					if (!hasPendingFrame)
+						return;
+
+					std::swap(currentFrame, pendingFrame);
+
+					hasPendingFrame = false;
+				}
+
+				condition.notify_all();
+
+				try
+				{
+					Present(currentFrame);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+
+					exception = std::current_exception();
+					isStopping = true;
+
+					condition.notify_all();
+
+					return;
+				}
+			}
+		}
+
+		void Present(const RenderSnapshot& snapshot)
+		{
+			RenderCommandQueue::GetInstance().ExecutePending();
+
+			Window::GetInstance().Clear();
+
+			snapshot.Draw();
+
+			Window::GetInstance().SwapBuffers();
+
+			auto now = std::chrono::steady_clock::now();
+
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (statistics.presentedFrames > 0)
+				statistics.frameTime = now - lastPresentTime;
+
+			statistics.inputLatency = now - snapshot.inputTime;
+
+			++statistics.presentedFrames;
+
+			lastPresentTime = now;
+		}
+
+		std::thread thread;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		RenderSnapshot pendingFrame;
+
+		bool hasPendingFrame = false;
+		bool isStarted = false;
+		bool isStopping = false;
+
+		std::exception_ptr exception;
+
+		FrameStatistics statistics;
+
+		std::chrono::steady_clock::time_point lastPresentTime;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<RenderThread> instance;
+
+	};
+
+	std::once_flag RenderThread::initializationFlag;
+	std::unique_ptr<RenderThread> RenderThread::instance;
+}
\ No newline at end of file
@@ -1,25 +1,56 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <limits>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include "ECS/Component.hpp"
 #include "Math/Matrix.hpp"
 #include "Math/Vector.hpp"
+#include "Render/UniformBuffers.hpp"
 #include "Utility/AssetPath.hpp"
 #include "Utility/FileSystem.hpp"
+#include "Utility/Exception/Exceptions/IllegalStateException.hpp"
 
 using namespace Wasteland::ECS;
 using namespace Wasteland::Math;
 using namespace Wasteland::Utility;
+using namespace Wasteland::Utility::Exception::Exceptions;
 
 namespace Wasteland::Render
 {
+	template <typename T>
+	concept UniformType = std::same_as<T, bool> || std::same_as<T, int> || std::same_as<T, float> || std::same_as<T, Vector<int, 2>> || std::same_as<T, Vector<float, 2>> || std::same_as<T, Vector<int, 3>> || std::same_as<T, Vector<float, 3>> || std::same_as<T, Matrix<float, 4, 4>>;
+
+	template <UniformType T>
+	struct UniformHandle
+	{
+		static constexpr size_t INVALID_INDEX = std::numeric_limits<size_t>::max();
+
+		bool IsValid() const
+		{
+			return index != INVALID_INDEX;
+		}
+
+		size_t index = INVALID_INDEX;
+	};
+
 	class Shader final : public Component
 	{
 
 	public:
+
+		static constexpr const char* DIFFUSE_SAMPLER_NAME = "diffuse";
+		static constexpr int DIFFUSE_TEXTURE_UNIT = 0;
 		
 		Shader(const Shader&) = delete;
 		Shader(Shader&&) = delete;
@@ -46,44 +77,51 @@ namespace Wasteland::Render
 			glUseProgram(0);
 		}
 
-		void SetUniform(const std::string& name, bool value)
+		template <UniformType T>
+		UniformHandle<T> GetUniform(const std::string& name) const
 		{
-			glUniform1i(glGetUniformLocation(id, name.c_str()), value);
-		}
+			auto iterator = uniformIndices.find(name);
 
-		void SetUniform(const std::string& name, int value)
-		{
-			glUniform1i(glGetUniformLocation(id, name.c_str()), value);
-		}
+			if (iterator == uniformIndices.end())
+				return { };
 
-		void SetUniform(const std::string& name, float value)
-		{
-			glUniform1f(glGetUniformLocation(id, name.c_str()), value);
-		}
+			if (!IsCompatible<T>(uniforms[iterator->second].type))
+				throw MAKE_EXCEPTION(IllegalStateException, std::format("Uniform '{}' of shader '{}' does not match the requested type!", name, this->name));
 
-		void SetUniform(const std::string& name, const Vector<int, 2>& value)
-		{
-			glUniform2i(glGetUniformLocation(id, name.c_str()), value.x(), value.y());
+			return UniformHandle<T>{ iterator->second };
 		}
 
-		void SetUniform(const std::string& name, const Vector<float, 2>& value)
+		UniformHandle<int> GetDiffuseSampler() const
 		{
-			glUniform2f(glGetUniformLocation(id, name.c_str()), value.x(), value.y());
+			return diffuseSampler;
 		}
 
-		void SetUniform(const std::string& name, const Vector<int, 3>& value)
+		bool HasUniform(const std::string& name) const
 		{
-			glUniform3i(glGetUniformLocation(id, name.c_str()), value.x(), value.y(), value.z());
+			return uniformIndices.contains(name);
 		}
 
-		void SetUniform(const std::string& name, const Vector<float, 3>& value)
+		template <UniformType T>
+		void SetUniform(UniformHandle<T> handle, const T& value)
 		{
-			glUniform3f(glGetUniformLocation(id, name.c_str()), value.x(), value.y(), value.z());
+			if (!handle.IsValid())
+				return;
+
+			UniformSlot& uniform = uniforms[handle.index];
+
+			if (uniform.hasValue && std::memcmp(uniform.value.data(), &value, sizeof(T)) == 0)
+				return;
+
+			std::memcpy(uniform.value.data(), &value, sizeof(T));
+			uniform.hasValue = true;
+
+			Upload(uniform.location, value);
 		}
 
-		void SetUniform(const std::string& name, const Matrix<float, 4, 4>& value)
+		template <UniformType T>
+		void SetUniform(const std::string& name, const T& value)
 		{
-			glUniformMatrix4fv(glGetUniformLocation(id, name.c_str()), 1, GL_FALSE, &value[0][0]);
+			SetUniform(GetUniform<T>(name), value);
 		}
 
 		void Uninitialize()
@@ -109,8 +147,79 @@ namespace Wasteland::Render
 
 	private:
 
+		struct UniformSlot
+		{
+			GLint location = -1;
+			GLenum type = 0;
+
+			bool hasValue = false;
+
+			alignas(16) std::array<std::byte, sizeof(Matrix<float, 4, 4>)> value = { };
+		};
+
 		Shader() = default;
 
+		template <typename T>
+		static constexpr bool IsCompatible(GLenum type)
+		{
+			if constexpr (std::same_as<T, bool>)
+				return type == GL_BOOL || type == GL_INT;
+			else if constexpr (std::same_as<T, int>)
+				return type == GL_INT || type == GL_BOOL || type == GL_SAMPLER_2D || type == GL_SAMPLER_3D || type == GL_SAMPLER_CUBE || type == GL_SAMPLER_2D_ARRAY;
+			else if constexpr (std::same_as<T, float>)
+				return type == GL_FLOAT;
+			else if constexpr (std::same_as<T, Vector<int, 2>>)
+				return type == GL_INT_VEC2;
+			else if constexpr (std::same_as<T, Vector<float, 2>>)
+				return type == GL_FLOAT_VEC2;
+			else if constexpr (std::same_as<T, Vector<int, 3>>)
+				return type == GL_INT_VEC3;
+			else if constexpr (std::same_as<T, Vector<float, 3>>)
+				return type == GL_FLOAT_VEC3;
+			else
+				return type == GL_FLOAT_MAT4;
+		}
+
+		static void Upload(GLint location, bool value)
+		{
+			glUniform1i(location, value);
+		}
+
+		static void Upload(GLint location, int value)
+		{
+			glUniform1i(location, value);
+		}
+
+		static void Upload(GLint location, float value)
+		{
+			glUniform1f(location, value);
+		}
+
+		static void Upload(GLint location, const Vector<int, 2>& value)
+		{
+			glUniform2i(location, value.x(), value.y());
+		}
+
+		static void Upload(GLint location, const Vector<float, 2>& value)
+		{
+			glUniform2f(location, value.x(), value.y());
+		}
+
+		static void Upload(GLint location, const Vector<int, 3>& value)
+		{
+			glUniform3i(location, value.x(), value.y(), value.z());
+		}
+
+		static void Upload(GLint location, const Vector<float, 3>& value)
+		{
+			glUniform3f(location, value.x(), value.y(), value.z());
+		}
+
+		static void Upload(GLint location, const Matrix<float, 4, 4>& value)
+		{
+			glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
+		}
+
 		void Generate()
 		{
 			unsigned int vertexShader = CompileShader(GL_VERTEX_SHADER, vertexData);
@@ -135,6 +244,57 @@ namespace Wasteland::Render
 
 			glDeleteShader(vertexShader);
 			glDeleteShader(fragmentShader);
+
+			ReflectUniforms();
+
+			diffuseSampler = GetUniform<int>(DIFFUSE_SAMPLER_NAME);
+
+			BindUniformBlock(UniformBuffers::FRAME_BLOCK_NAME, UniformBuffers::FRAME_BINDING);
+			BindUniformBlock(UniformBuffers::OBJECT_BLOCK_NAME, UniformBuffers::OBJECT_BINDING);
+		}
+
+		void ReflectUniforms()
+		{
+			int count = 0;
+			int maximumNameLength = 0;
+
+			glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+			glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maximumNameLength);
+
+			std::string buffer(static_cast<size_t>(std::max(maximumNameLength, 1)), '\0');
+
+			uniforms.clear();
+			uniformIndices.clear();
+
+			for (int i = 0; i < count; ++i)
+			{
+				GLsizei length = 0;
+				GLint size = 0;
+				GLenum type = 0;
+
+				glGetActiveUniform(id, static_cast<GLuint>(i), static_cast<GLsizei>(buffer.size()), &length, &size, &type, buffer.data());
+
+				std::string uniformName(buffer.data(), static_cast<size_t>(length));
+
+				GLint location = glGetUniformLocation(id, uniformName.c_str());
+
+				if (location < 0)
+					continue;
+
+				if (uniformName.ends_with("[0]"))
+					uniformName.resize(uniformName.size() - 3);
+
+				uniformIndices.emplace(uniformName, uniforms.size());
+				uniforms.push_back({ location, type });
+			}
+		}
+
+		void BindUniformBlock(const char* blockName, GLuint binding)
+		{
+			GLuint blockIndex = glGetUniformBlockIndex(id, blockName);
+
+			if (blockIndex != GL_INVALID_INDEX)
+				glUniformBlockBinding(id, blockIndex, binding);
 		}
 
 		unsigned int CompileShader(GLenum type, const std::string& data)
@@ -170,5 +330,10 @@ namespace Wasteland::Render
 
 		unsigned int id;
 
+		std::vector<UniformSlot> uniforms;
+		std::unordered_map<std::string, size_t> uniformIndices;
+
+		UniformHandle<int> diffuseSampler;
+
 	};
 }
\ No newline at end of file
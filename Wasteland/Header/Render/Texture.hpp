@@ -1,18 +1,24 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <FreeImage.h>
 #include "ECS/Component.hpp"
 #include "Math/Vector.hpp"
+#include "Render/UploadThread.hpp"
+#include "Thread/Task.hpp"
 #include "Utility/AssetPath.hpp"
 #include "Utility/FileSystem.hpp"
 #include "Utility/Exception/Exceptions/IOException.hpp"
 
 using namespace Wasteland::ECS;
 using namespace Wasteland::Math;
+using namespace Wasteland::Thread;
 using namespace Wasteland::Utility;
 using namespace Wasteland::Utility::Exception::Exceptions;
 
@@ -49,8 +55,30 @@ namespace Wasteland::Render
             glBindTexture(GL_TEXTURE_2D, 0);
         }
 
+        bool MakeResident()
+        {
+            if (isResident)
+                return true;
+
+            if (!isUploaded.load(std::memory_order_acquire))
+                return false;
+
+            if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+                return false;
+
+            glDeleteSync(fence);
+            fence = nullptr;
+
+            isResident = true;
+
+            return true;
+        }
+
         void Uninitialize()
         {
+            if (fence)
+                glDeleteSync(fence);
+
             glDeleteTextures(1, &id);
         }
 
@@ -61,17 +89,39 @@ namespace Wasteland::Render
             result->name = name;
             result->path = path;
 
-            result->Generate();
+            result->Decode();
+
+            UploadThread::GetInstance().Enqueue([result]() { result->Upload(); });
 
             return result;
         }
 
+        static Task<std::shared_ptr<Texture>> Load(std::string name, AssetPath path)
+        {
+            std::shared_ptr<Texture> result(new Texture());
+
+            result->name = std::move(name);
+            result->path = std::move(path);
+
+            co_await ToWorker();
+
+            result->Decode();
+
+            co_await ToMainThread();
+
+            UploadThread::GetInstance().Enqueue([result]() { result->Upload(); });
+
+            co_return result;
+        }
+
     private:
 
         Texture() = default;
 
-        void Generate()
+        void Decode()
         {
+            std::lock_guard<std::mutex> lock(decodeMutex);
+
             std::string fullPath = path.GetFullPath();
 
             FreeImage_Initialise();
@@ -84,14 +134,24 @@ namespace Wasteland::Render
 
             FreeImage_Unload(bitmap);
 
-            int width = FreeImage_GetWidth(image);
-            int height = FreeImage_GetHeight(image);
-            void* pixels = FreeImage_GetBits(image);
+            width = FreeImage_GetWidth(image);
+            height = FreeImage_GetHeight(image);
 
+            unsigned char* bits = FreeImage_GetBits(image);
+
+            pixels.assign(bits, bits + static_cast<size_t>(width) * height * 4);
+
+            FreeImage_Unload(image);
+
+            FreeImage_DeInitialise();
+        }
+
+        void Upload()
+        {
             glGenTextures(1, &id);
             glBindTexture(GL_TEXTURE_2D, id);
 
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, pixels);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_BGRA, GL_UNSIGNED_BYTE, pixels.data());
             glGenerateMipmap(GL_TEXTURE_2D);
 
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
@@ -100,15 +160,33 @@ namespace Wasteland::Render
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-            FreeImage_Unload(image);
-
             glBindTexture(GL_TEXTURE_2D, 0);
 
-            FreeImage_DeInitialise();
+            fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+            glFlush();
+
+            std::vector<unsigned char>().swap(pixels);
+
+            isUploaded.store(true, std::memory_order_release);
         }
 
         std::string name;
         AssetPath path;
         unsigned int id = 0;
+
+        int width = 0;
+        int height = 0;
+
+        std::vector<unsigned char> pixels;
+
+        GLsync fence = nullptr;
+
+        std::atomic<bool> isUploaded = false;
+        bool isResident = false;
+
+        static std::mutex decodeMutex;
     };
+
+    std::mutex Texture::decodeMutex;
 }
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <glad/glad.h>
+#include "Math/Matrix.hpp"
+#include "Render/Camera.hpp"
+#include "Utility/Exception/Exceptions/GraphicalErrorException.hpp"
+
+using namespace Wasteland::Math;
+using namespace Wasteland::Utility::Exception::Exceptions;
+
+namespace Wasteland::Render
+{
+	struct FrameUniforms
+	{
+		Matrix<float, 4, 4> view;
+		Matrix<float, 4, 4> projection;
+		Matrix<float, 4, 4> viewProjection;
+
+		float cameraPosition[3];
+		float time;
+	};
+
+	struct ObjectUniforms
+	{
+		Matrix<float, 4, 4> model;
+	};
+
+	static_assert(sizeof(FrameUniforms) == 208 && offsetof(FrameUniforms, cameraPosition) == 192, "FrameUniforms must match the std140 layout of FrameData!");
+	static_assert(sizeof(ObjectUniforms) == 64, "ObjectUniforms must match the std140 layout of ObjectData!");
+
+	class UniformBuffers final
+	{
+
+	public:
+
+		static constexpr GLuint FRAME_BINDING = 0;
+		static constexpr GLuint OBJECT_BINDING = 1;
+
+		static constexpr const char* FRAME_BLOCK_NAME = "FrameData";
+		static constexpr const char* OBJECT_BLOCK_NAME = "ObjectData";
+
+		UniformBuffers(const UniformBuffers&) = delete;
+		UniformBuffers(UniformBuffers&&) = delete;
+		UniformBuffers& operator=(const UniformBuffers&) = delete;
+		UniformBuffers& operator=(UniformBuffers&&) = delete;
+
+		template <std::ranges::sized_range Range, typename Projection>
+		void BeginFrame(const CameraData& camera, float time, const Range& objects, Projection projection)
+		{
+			if (!buffer)
+				Generate();
+
+			segment = (segment + 1) % SEGMENT_COUNT;
+
+			Segment& current = segments[segment];
+
+			if (current.fence)
+			{
+				glClientWaitSync(current.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+				glDeleteSync(current.fence);
+
+				current.fence = nullptr;
+			}
+
+			size_t objectCount = std::ranges::size(objects);
+
+			if (objectCount > objectCapacity)
+				Reserve(objectCount);
+
+			glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+
+			std::byte* destination = static_cast<std::byte*>(glMapBufferRange(GL_UNIFORM_BUFFER, GetSegmentOffset(segment), segmentSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+
+			if (!destination)
+				throw MAKE_EXCEPTION(GraphicalErrorException, "Failed to map the uniform ring buffer!");
+
+			FrameUniforms frame = { camera.view, camera.projection, camera.viewProjection, { camera.position.x(), camera.position.y(), camera.position.z() }, time };
+
+			std::memcpy(destination, &frame, sizeof(FrameUniforms));
+
+			std::byte* objectDestination = destination + frameStride;
+
+			for (const auto& object : objects)
+			{
+				ObjectUniforms uniforms = { std::invoke(projection, object) };
+
+				std::memcpy(objectDestination, &uniforms, sizeof(ObjectUniforms));
+
+				objectDestination += objectStride;
+			}
+
+			glUnmapBuffer(GL_UNIFORM_BUFFER);
+			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+			glBindBufferRange(GL_UNIFORM_BUFFER, FRAME_BINDING, buffer, GetSegmentOffset(segment), sizeof(FrameUniforms));
+		}
+
+		void BindObject(size_t index)
+		{
+			glBindBufferRange(GL_UNIFORM_BUFFER, OBJECT_BINDING, buffer, GetSegmentOffset(segment) + frameStride + index * objectStride, sizeof(ObjectUniforms));
+		}
+
+		void EndFrame()
+		{
+			segments[segment].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+
+		void Uninitialize()
+		{
+			for (Segment& current : segments)
+			{
+				if (current.fence)
+					glDeleteSync(current.fence);
+
+				current.fence = nullptr;
+			}
+
+			if (buffer)
+				glDeleteBuffers(1, &buffer);
+
+			buffer = 0;
+			objectCapacity = 0;
+		}
+
+		static UniformBuffers& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<UniformBuffers>(new UniformBuffers());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		static constexpr size_t SEGMENT_COUNT = 3;
+		static constexpr size_t INITIAL_OBJECT_CAPACITY = 1024;
+
+		struct Segment
+		{
+			GLsync fence = nullptr;
+		};
+
+		UniformBuffers() = default;
+
+		void Generate()
+		{
+			GLint alignment = 0;
+
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+			offsetAlignment = std::max<size_t>(static_cast<size_t>(alignment), 16);
+
+			frameStride = Align(sizeof(FrameUniforms));
+			objectStride = Align(sizeof(ObjectUniforms));
+
+			glGenBuffers(1, &buffer);
+
+			Reserve(INITIAL_OBJECT_CAPACITY);
+		}
+
+		void Reserve(size_t count)
+		{
+			for (Segment& current : segments)
+			{
+				if (!current.fence)
+					continue;
+
+				glClientWaitSync(current.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+				glDeleteSync(current.fence);
+
+				current.fence = nullptr;
+			}
+
+			objectCapacity = std::max(count, objectCapacity * 2);
+			segmentSize = Align(frameStride + objectCapacity * objectStride);
+
+			glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+			glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(segmentSize * SEGMENT_COUNT), nullptr, GL_STREAM_DRAW);
+			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		}
+
+		size_t Align(size_t size) const
+		{
+			return (size + offsetAlignment - 1) / offsetAlignment * offsetAlignment;
+		}
+
+		GLintptr GetSegmentOffset(size_t index) const
+		{
+			return static_cast<GLintptr>(index * segmentSize);
+		}
+
+		GLuint buffer = 0;
+
+		std::array<Segment, SEGMENT_COUNT> segments;
+		size_t segment = 0;
+
+		size_t offsetAlignment = 256;
+		size_t frameStride = 0;
+		size_t objectStride = 0;
+		size_t objectCapacity = 0;
+		size_t segmentSize = 0;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<UniformBuffers> instance;
+
+	};
+
+	std::once_flag UniformBuffers::initializationFlag;
+	std::unique_ptr<UniformBuffers> UniformBuffers::instance;
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "Core/Window.hpp"
+#include "Render/RenderCommandQueue.hpp"
+#include "Thread/Job.hpp"
+
+using namespace Wasteland::Core;
+using namespace Wasteland::Thread;
+
+namespace Wasteland::Render
+{
+	class UploadThread final
+	{
+
+	public:
+
+		UploadThread(const UploadThread&) = delete;
+		UploadThread(UploadThread&&) = delete;
+		UploadThread& operator=(const UploadThread&) = delete;
+		UploadThread& operator=(UploadThread&&) = delete;
+
+		~UploadThread()
+		{
+			if (!thread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				isStopping = true;
+			}
+
+			condition.notify_all();
+
+			thread.join();
+		}
+
+		void Start()
+		{
+			if (thread.joinable())
+				return;
+
+			isStopping = false;
+
+			context = Window::GetInstance().CreateSharedContext();
+
+			thread = std::thread([this]()
+			{
+				glfwMakeContextCurrent(context);
+
+				Run();
+
+				glfwMakeContextCurrent(nullptr);
+			});
+
+			std::lock_guard<std::mutex> lock(mutex);
+
+			isRunning = true;
+		}
+
+		void Stop()
+		{
+			if (!thread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				isRunning = false;
+				isStopping = true;
+			}
+
+			condition.notify_all();
+
+			thread.join();
+
+			Window::GetInstance().DestroySharedContext(context);
+
+			context = nullptr;
+		}
+
+		void Enqueue(Job upload)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				if (isRunning)
+				{
+					uploads.push_back(std::move(upload));
+
+					condition.notify_one();
+
+					return;
+				}
+			}
+
+			RenderCommandQueue::GetInstance().Enqueue(std::move(upload));
+		}
+
+		static UploadThread& GetInstance()
+		{
+			std::call_once(initializationFlag, [&]()
+			{
+				instance = std::unique_ptr<UploadThread>(new UploadThread());
+			});
+
+			return *instance;
+		}
+
+	private:
+
+		UploadThread() = default;
+
+		void Run()
+		{
+			std::vector<Job> pending;
+
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+
+					condition.wait(lock, [this]() { return !uploads.empty() || isStopping; });
+
+					if (uploads.empty())
+						return;
+
+					pending.swap(uploads);
+				}
+
+				for (Job& upload : pending)
+					upload();
+
+				pending.clear();
+
+				glFlush();
+			}
+		}
+
+		std::thread thread;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		std::vector<Job> uploads;
+
+		bool isRunning = false;
+		bool isStopping = false;
+
+		GLFWwindow* context = nullptr;
+
+		static std::once_flag initializationFlag;
+		static std::unique_ptr<UploadThread> instance;
+
+	};
+
+	std::once_flag UploadThread::initializationFlag;
+	std::unique_ptr<UploadThread> UploadThread::instance;
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace Wasteland::Thread
+{
+    class CoroutineFramePool final
+    {
+
+    public:
+
+        CoroutineFramePool(const CoroutineFramePool&) = delete;
+        CoroutineFramePool(CoroutineFramePool&&) = delete;
+        CoroutineFramePool& operator=(const CoroutineFramePool&) = delete;
+        CoroutineFramePool& operator=(CoroutineFramePool&&) = delete;
+
+        static void* Allocate(size_t size)
+        {
+            size_t sizeClass = GetSizeClass(size);
+
+            if (sizeClass >= SIZE_CLASS_COUNT)
+                return ::operator new(size);
+
+            Cache& cache = GetCache();
+
+            if (!cache.freeLists[sizeClass])
+                Reclaim(cache, sizeClass);
+
+            if (FreeBlock* block = cache.freeLists[sizeClass])
+            {
+                cache.freeLists[sizeClass] = block->next;
+                --cache.counts[sizeClass];
+
+                return block;
+            }
+
+            return ::operator new((sizeClass + 1) * GRANULARITY);
+        }
+
+        static void Deallocate(void* pointer, size_t size)
+        {
+            size_t sizeClass = GetSizeClass(size);
+
+            if (sizeClass >= SIZE_CLASS_COUNT)
+            {
+                ::operator delete(pointer);
+                return;
+            }
+
+            Cache& cache = GetCache();
+
+            FreeBlock* block = static_cast<FreeBlock*>(pointer);
+
+            if (cache.counts[sizeClass] >= MAXIMUM_CACHED_BLOCKS)
+            {
+                Release(block, sizeClass);
+                return;
+            }
+
+            block->next = cache.freeLists[sizeClass];
+            cache.freeLists[sizeClass] = block;
+
+            ++cache.counts[sizeClass];
+        }
+
+    private:
+
+        static constexpr size_t GRANULARITY = 64;
+        static constexpr size_t SIZE_CLASS_COUNT = 64;
+        static constexpr size_t MAXIMUM_CACHED_BLOCKS = 256;
+        static constexpr size_t MAXIMUM_SHARED_BLOCKS = 1024;
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct Cache
+        {
+            ~Cache()
+            {
+                for (size_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; ++sizeClass)
+                {
+                    FreeBlock* head = freeLists[sizeClass];
+
+                    while (head)
+                    {
+                        FreeBlock* next = head->next;
+
+                        Release(head, sizeClass);
+
+                        head = next;
+                    }
+                }
+            }
+
+            std::array<FreeBlock*, SIZE_CLASS_COUNT> freeLists = { };
+            std::array<size_t, SIZE_CLASS_COUNT> counts = { };
+        };
+
+        struct SharedLists
+        {
+            ~SharedLists()
+            {
+                for (auto& list : heads)
+                {
+                    FreeBlock* head = list.exchange(nullptr, std::memory_order_acquire);
+
+                    while (head)
+                    {
+                        FreeBlock* next = head->next;
+
+                        ::operator delete(head);
+
+                        head = next;
+                    }
+                }
+            }
+
+            std::array<std::atomic<FreeBlock*>, SIZE_CLASS_COUNT> heads = { };
+            std::array<std::atomic<size_t>, SIZE_CLASS_COUNT> counts = { };
+        };
+
+        CoroutineFramePool() = default;
+
+        static size_t GetSizeClass(size_t size)
+        {
+            return (size + GRANULARITY - 1) / GRANULARITY - 1;
+        }
+
+        static void Release(FreeBlock* block, size_t sizeClass)
+        {
+            SharedLists& shared = GetSharedLists();
+
+            if (shared.counts[sizeClass].fetch_add(1, std::memory_order_relaxed) >= MAXIMUM_SHARED_BLOCKS)
+            {
+                shared.counts[sizeClass].fetch_sub(1, std::memory_order_relaxed);
+
+                ::operator delete(block);
+                return;
+            }
+
+            FreeBlock* head = shared.heads[sizeClass].load(std::memory_order_relaxed);
+
+            do
+                block->next = head;
+            while (!shared.heads[sizeClass].compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        static void Reclaim(Cache& cache, size_t sizeClass)
+        {
+            SharedLists& shared = GetSharedLists();
+
+            if (!shared.heads[sizeClass].load(std::memory_order_relaxed))
+                return;
+
+            FreeBlock* head = shared.heads[sizeClass].exchange(nullptr, std::memory_order_acquire);
+
+            size_t count = 0;
+
+            for (FreeBlock* block = head; block; block = block->next)
+                ++count;
+
+            shared.counts[sizeClass].fetch_sub(count, std::memory_order_relaxed);
+
+            cache.freeLists[sizeClass] = head;
+            cache.counts[sizeClass] = count;
+        }
+
+        static SharedLists& GetSharedLists()
+        {
+            static SharedLists shared;
+
+            return shared;
+        }
+
+        static Cache& GetCache()
+        {
+            static thread_local Cache cache;
+
+            return cache;
+        }
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Wasteland::Thread
+{
+    template <typename F>
+    concept JobFunction = std::invocable<std::decay_t<F>&> && std::move_constructible<std::decay_t<F>>;
+
+    class Job final
+    {
+
+    public:
+
+        static constexpr size_t INLINE_CAPACITY = 48;
+
+        Job() = default;
+
+        template <JobFunction F> requires (!std::same_as<std::decay_t<F>, Job>)
+        Job(F&& function)
+        {
+            using Function = std::decay_t<F>;
+
+            if constexpr (IsInline<Function>)
+            {
+                new (storage) Function(std::forward<F>(function));
+                operations = &INLINE_OPERATIONS<Function>;
+            }
+            else
+            {
+                *reinterpret_cast<Function**>(storage) = new Function(std::forward<F>(function));
+                operations = &HEAP_OPERATIONS<Function>;
+            }
+        }
+
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        Job(Job&& other) noexcept
+        {
+            MoveFrom(other);
+        }
+
+        Job& operator=(Job&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(other);
+            }
+
+            return *this;
+        }
+
+        ~Job()
+        {
+            Reset();
+        }
+
+        void operator()()
+        {
+            operations->invoke(storage);
+        }
+
+        explicit operator bool() const
+        {
+            return operations != nullptr;
+        }
+
+        void Reset()
+        {
+            if (!operations)
+                return;
+
+            operations->destroy(storage);
+            operations = nullptr;
+        }
+
+    private:
+
+        struct Operations
+        {
+            void (*invoke)(void*);
+            void (*move)(void*, void*);
+            void (*destroy)(void*);
+        };
+
+        template <typename Function>
+        static constexpr bool IsInline = sizeof(Function) <= INLINE_CAPACITY && alignof(Function) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Function>;
+
+        template <typename Function>
+        static constexpr Operations INLINE_OPERATIONS =
+        {
+            [](void* self) { (*std::launder(reinterpret_cast<Function*>(self)))(); },
+            [](void* destination, void* source)
+            {
+                Function* from = std::launder(reinterpret_cast<Function*>(source));
+
+                new (destination) Function(std::move(*from));
+
+                from->~Function();
+            },
+            [](void* self) { std::launder(reinterpret_cast<Function*>(self))->~Function(); }
+        };
+
+        template <typename Function>
+        static constexpr Operations HEAP_OPERATIONS =
+        {
+            [](void* self) { (**reinterpret_cast<Function**>(self))(); },
+            [](void* destination, void* source) { *reinterpret_cast<Function**>(destination) = *reinterpret_cast<Function**>(source); },
+            [](void* self) { delete *reinterpret_cast<Function**>(self); }
+        };
+
+        void MoveFrom(Job& other) noexcept
+        {
+            if (!other.operations)
+                return;
+
+            other.operations->move(storage, other.storage);
+
+            operations = other.operations;
+            other.operations = nullptr;
+        }
+
+        alignas(std::max_align_t) std::byte storage[INLINE_CAPACITY];
+
+        const Operations* operations = nullptr;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <variant>
+#include <vector>
+#include "Thread/Job.hpp"
+#include "Thread/JobSystem.hpp"
+#include "Thread/MainThreadExecutor.hpp"
+#include "Utility/Exception/Exceptions/IllegalStateException.hpp"
+
+using namespace Wasteland::Utility::Exception::Exceptions;
+
+namespace Wasteland::Thread
+{
+    enum class JobTarget
+    {
+        WORKER,
+        MAIN_THREAD,
+        IMMEDIATE
+    };
+
+    template <typename T>
+    class JobState final
+    {
+
+    public:
+
+        using ValueType = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        bool IsReady() const
+        {
+            return ready.load(std::memory_order_acquire);
+        }
+
+        template <typename... Args>
+        void SetValue(Args&&... args)
+        {
+            value.emplace(std::forward<Args>(args)...);
+            Complete();
+        }
+
+        void SetException(std::exception_ptr exception)
+        {
+            this->exception = exception;
+            Complete();
+        }
+
+        std::exception_ptr GetException() const
+        {
+            return exception;
+        }
+
+        const ValueType& GetValue() const
+        {
+            return *value;
+        }
+
+        void AddContinuation(JobTarget target, Job job, TaskPriority priority = TaskPriority::NORMAL)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (!ready.load(std::memory_order_relaxed))
+                {
+                    continuations.push_back({ target, priority, std::move(job) });
+                    return;
+                }
+            }
+
+            Dispatch(target, std::move(job), priority);
+        }
+
+        template <typename F, typename... Args>
+        void Fulfill(F& function, const Args&... args)
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    std::invoke(function, args...);
+                    SetValue();
+                }
+                else
+                    SetValue(std::invoke(function, args...));
+            }
+            catch (...)
+            {
+                SetException(std::current_exception());
+            }
+        }
+
+        static void Dispatch(JobTarget target, Job job, TaskPriority priority = TaskPriority::NORMAL)
+        {
+            switch (target)
+            {
+            case JobTarget::MAIN_THREAD:
+                MainThreadExecutor::GetInstance().EnqueueTask(std::move(job), priority);
+                break;
+
+            case JobTarget::IMMEDIATE:
+                job();
+                break;
+
+            default:
+                JobSystem::GetInstance().Submit(std::move(job));
+                break;
+            }
+        }
+
+    private:
+
+        struct Continuation
+        {
+            JobTarget target;
+            TaskPriority priority;
+            Job job;
+        };
+
+        void Complete()
+        {
+            std::vector<Continuation> pending;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                ready.store(true, std::memory_order_release);
+
+                pending.swap(continuations);
+            }
+
+            for (auto& continuation : pending)
+                Dispatch(continuation.target, std::move(continuation.job), continuation.priority);
+        }
+
+        std::mutex mutex;
+        std::atomic<bool> ready = false;
+
+        std::optional<ValueType> value;
+        std::exception_ptr exception;
+
+        std::vector<Continuation> continuations;
+
+    };
+
+    class JobGraph;
+
+    template <typename T>
+    class JobHandle final
+    {
+
+    public:
+
+        JobHandle() = default;
+
+        bool IsValid() const
+        {
+            return state != nullptr;
+        }
+
+        bool IsReady() const
+        {
+            return state && state->IsReady();
+        }
+
+        void Wait() const
+        {
+            if (!state)
+                throw MAKE_EXCEPTION(IllegalStateException, "Cannot wait on an invalid job handle!");
+
+            bool isMainThread = MainThreadExecutor::GetInstance().IsMainThread();
+
+            while (!state->IsReady())
+            {
+                if (isMainThread && MainThreadExecutor::GetInstance().RunPendingTask())
+                    continue;
+
+                if (!JobSystem::GetInstance().RunPendingJob())
+                    std::this_thread::yield();
+            }
+        }
+
+        const typename JobState<T>::ValueType& Get() const
+        {
+            Wait();
+
+            if (auto exception = state->GetException())
+                std::rethrow_exception(exception);
+
+            return state->GetValue();
+        }
+
+        template <typename F>
+        auto Then(F&& function, JobTarget target = JobTarget::WORKER, TaskPriority priority = TaskPriority::NORMAL) const
+        {
+            if (!state)
+                throw MAKE_EXCEPTION(IllegalStateException, "Cannot continue an invalid job handle!");
+
+            using R = ContinuationResult<F>;
+
+            auto next = std::make_shared<JobState<R>>();
+
+            state->AddContinuation(target, [antecedent = state, next, function = std::forward<F>(function)]() mutable
+            {
+                if (auto exception = antecedent->GetException())
+                {
+                    next->SetException(exception);
+                    return;
+                }
+
+                if constexpr (std::is_void_v<T>)
+                    next->Fulfill(function);
+                else
+                    next->Fulfill(function, antecedent->GetValue());
+            }, priority);
+
+            return JobHandle<R>(std::move(next));
+        }
+
+        template <typename F>
+        auto ThenOnMainThread(F&& function, TaskPriority priority = TaskPriority::NORMAL) const
+        {
+            return Then(std::forward<F>(function), JobTarget::MAIN_THREAD, priority);
+        }
+
+        auto operator co_await() const
+        {
+            if (!state)
+                throw MAKE_EXCEPTION(IllegalStateException, "Cannot await an invalid job handle!");
+
+            struct Awaiter
+            {
+                std::shared_ptr<JobState<T>> state;
+
+                bool await_ready() const noexcept
+                {
+                    return state->IsReady();
+                }
+
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    state->AddContinuation(JobTarget::IMMEDIATE, [handle]() { handle.resume(); });
+                }
+
+                const typename JobState<T>::ValueType& await_resume() const
+                {
+                    if (auto exception = state->GetException())
+                        std::rethrow_exception(exception);
+
+                    return state->GetValue();
+                }
+            };
+
+            return Awaiter{ state };
+        }
+
+    private:
+
+        template <typename F>
+        struct ContinuationResultOf
+        {
+            using Type = std::invoke_result_t<std::decay_t<F>&, const typename JobState<T>::ValueType&>;
+        };
+
+        template <typename F> requires std::is_void_v<T>
+        struct ContinuationResultOf<F>
+        {
+            using Type = std::invoke_result_t<std::decay_t<F>&>;
+        };
+
+        template <typename F>
+        using ContinuationResult = typename ContinuationResultOf<F>::Type;
+
+        explicit JobHandle(std::shared_ptr<JobState<T>> state) : state(std::move(state)) { }
+
+        std::shared_ptr<JobState<T>> state;
+
+        template <typename>
+        friend class JobHandle;
+
+        friend class JobGraph;
+
+    };
+
+    class JobGraph final
+    {
+
+    public:
+
+        JobGraph(const JobGraph&) = delete;
+        JobGraph(JobGraph&&) = delete;
+        JobGraph& operator=(const JobGraph&) = delete;
+        JobGraph& operator=(JobGraph&&) = delete;
+
+        template <typename F>
+        static auto Schedule(F&& function, JobTarget target = JobTarget::WORKER, TaskPriority priority = TaskPriority::NORMAL)
+        {
+            using R = std::invoke_result_t<std::decay_t<F>&>;
+
+            auto state = std::make_shared<JobState<R>>();
+
+            JobState<R>::Dispatch(target, [state, function = std::forward<F>(function)]() mutable
+            {
+                state->Fulfill(function);
+            }, priority);
+
+            return JobHandle<R>(std::move(state));
+        }
+
+        template <typename F>
+        static auto ScheduleOnMainThread(F&& function, TaskPriority priority = TaskPriority::NORMAL)
+        {
+            return Schedule(std::forward<F>(function), JobTarget::MAIN_THREAD, priority);
+        }
+
+        template <typename... Ts>
+        static JobHandle<void> WhenAll(const JobHandle<Ts>&... handles)
+        {
+            auto join = std::make_shared<Join>(sizeof...(Ts));
+
+            (Attach(join, handles), ...);
+
+            return join->Finish();
+        }
+
+        template <typename T>
+        static JobHandle<void> WhenAll(const std::vector<JobHandle<T>>& handles)
+        {
+            auto join = std::make_shared<Join>(handles.size());
+
+            for (const auto& handle : handles)
+                Attach(join, handle);
+
+            return join->Finish();
+        }
+
+    private:
+
+        JobGraph() = default;
+
+        struct Join
+        {
+            explicit Join(size_t count) : remaining(count + 1) { }
+
+            void Arrive(std::exception_ptr exception)
+            {
+                if (exception)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    if (!firstException)
+                        firstException = exception;
+                }
+
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    return;
+
+                if (firstException)
+                    state->SetException(firstException);
+                else
+                    state->SetValue();
+            }
+
+            JobHandle<void> Finish()
+            {
+                JobHandle<void> result(state);
+
+                Arrive(nullptr);
+
+                return result;
+            }
+
+            std::atomic<size_t> remaining;
+
+            std::mutex mutex;
+            std::exception_ptr firstException;
+
+            std::shared_ptr<JobState<void>> state = std::make_shared<JobState<void>>();
+        };
+
+        template <typename T>
+        static void Attach(const std::shared_ptr<Join>& join, const JobHandle<T>& handle)
+        {
+            if (!handle.IsValid())
+            {
+                join->Arrive(nullptr);
+                return;
+            }
+
+            handle.state->AddContinuation(JobTarget::IMMEDIATE, [join, antecedent = handle.state]()
+            {
+                join->Arrive(antecedent->GetException());
+            });
+        }
+
+    };
+}
\ No newline at end of file
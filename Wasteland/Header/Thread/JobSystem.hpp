@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Thread/Job.hpp"
+#include "Thread/TaskSlotPool.hpp"
+#include "Thread/WorkStealingDeque.hpp"
+
+namespace Wasteland::Thread
+{
+    class JobSystem final
+    {
+
+    public:
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+
+        ~JobSystem()
+        {
+            Uninitialize();
+        }
+
+        void Submit(Job job)
+        {
+            if (workers.empty())
+            {
+                job();
+                return;
+            }
+
+            uint32_t slot = jobSlots.Acquire();
+
+            jobSlots.Get(slot).payload = std::move(job);
+
+            pendingJobs.fetch_add(1, std::memory_order_seq_cst);
+
+            if (workerIndex != NO_WORKER && owner == this)
+                workers[workerIndex]->deque.Push(slot);
+            else
+            {
+                std::lock_guard<std::mutex> lock(injectionMutex);
+                injectionQueue.push_back(slot);
+            }
+
+            if (sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(sleepMutex);
+                }
+
+                sleepCondition.notify_one();
+            }
+        }
+
+        template <typename F>
+        void ParallelFor(size_t begin, size_t end, size_t grainSize, F&& function)
+        {
+            ParallelForBatch(begin, end, grainSize, [&function](size_t batchBegin, size_t batchEnd)
+            {
+                for (size_t i = batchBegin; i < batchEnd; ++i)
+                    function(i);
+            });
+        }
+
+        template <typename F>
+        void ParallelForBatch(size_t begin, size_t end, size_t grainSize, F&& function)
+        {
+            if (begin >= end)
+                return;
+
+            grainSize = std::max<size_t>(grainSize, 1);
+
+            const size_t batchCount = (end - begin + grainSize - 1) / grainSize;
+
+            if (batchCount == 1 || workers.empty())
+            {
+                function(begin, end);
+                return;
+            }
+
+            struct Batch
+            {
+                size_t begin;
+                size_t end;
+                size_t grainSize;
+                F* function;
+                std::atomic<size_t> remaining;
+            };
+
+            Batch batch{ begin, end, grainSize, &function, batchCount - 1 };
+
+            for (size_t i = 1; i < batchCount; ++i)
+            {
+                Submit([&batch, i]()
+                {
+                    size_t batchBegin = batch.begin + i * batch.grainSize;
+
+                    (*batch.function)(batchBegin, std::min(batchBegin + batch.grainSize, batch.end));
+
+                    batch.remaining.fetch_sub(1, std::memory_order_release);
+                });
+            }
+
+            function(begin, std::min(begin + grainSize, end));
+
+            while (batch.remaining.load(std::memory_order_acquire) > 0)
+            {
+                if (!RunPendingJob())
+                    std::this_thread::yield();
+            }
+        }
+
+        bool RunPendingJob()
+        {
+            uint32_t slot;
+
+            if (!FindJob(owner == this ? workerIndex : NO_WORKER, slot))
+                return false;
+
+            Execute(slot);
+
+            return true;
+        }
+
+        size_t GetWorkerCount() const
+        {
+            return workers.size();
+        }
+
+        bool IsWorkerThread() const
+        {
+            return owner == this && workerIndex != NO_WORKER;
+        }
+
+        void Initialize(size_t workerCount)
+        {
+            Uninitialize();
+
+            stop.store(false);
+
+            workers.reserve(workerCount);
+
+            for (size_t i = 0; i < workerCount; ++i)
+                workers.push_back(std::make_unique<Worker>());
+
+            for (size_t i = 0; i < workerCount; ++i)
+                workers[i]->thread = std::thread(&JobSystem::WorkerThread, this, i);
+        }
+
+        void Uninitialize()
+        {
+            if (workers.empty())
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                stop.store(true);
+            }
+
+            sleepCondition.notify_all();
+
+            for (auto& worker : workers)
+            {
+                if (worker->thread.joinable())
+                    worker->thread.join();
+            }
+
+            workers.clear();
+        }
+
+        static JobSystem& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<JobSystem>(new JobSystem());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        static constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+
+        static constexpr int SPIN_COUNT = 64;
+
+        using JobSlotPool = TaskSlotPool<Job>;
+
+        struct Worker
+        {
+            WorkStealingDeque<uint32_t> deque;
+            std::thread thread;
+        };
+
+        JobSystem()
+        {
+            Initialize(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+        }
+
+        void WorkerThread(size_t index)
+        {
+            owner = this;
+            workerIndex = index;
+
+            int idleSpins = 0;
+
+            while (true)
+            {
+                uint32_t slot;
+
+                if (FindJob(index, slot))
+                {
+                    Execute(slot);
+                    idleSpins = 0;
+
+                    continue;
+                }
+
+                if (++idleSpins < SPIN_COUNT)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                idleSpins = 0;
+
+                std::unique_lock<std::mutex> lock(sleepMutex);
+
+                sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+
+                sleepCondition.wait(lock, [this]() { return stop.load() || pendingJobs.load(std::memory_order_seq_cst) > 0; });
+
+                sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+
+                if (stop.load() && pendingJobs.load() == 0)
+                    return;
+            }
+        }
+
+        bool FindJob(size_t index, uint32_t& slot)
+        {
+            if (index != NO_WORKER && workers[index]->deque.Pop(slot))
+                return Take();
+
+            {
+                std::lock_guard<std::mutex> lock(injectionMutex);
+
+                if (!injectionQueue.empty())
+                {
+                    slot = injectionQueue.front();
+                    injectionQueue.pop_front();
+
+                    return Take();
+                }
+            }
+
+            const size_t count = workers.size();
+            const size_t start = index == NO_WORKER ? 0 : index + 1;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t victim = (start + i) % count;
+
+                if (victim == index)
+                    continue;
+
+                if (workers[victim]->deque.Steal(slot))
+                    return Take();
+            }
+
+            return false;
+        }
+
+        bool Take()
+        {
+            pendingJobs.fetch_sub(1, std::memory_order_seq_cst);
+            return true;
+        }
+
+        void Execute(uint32_t slot)
+        {
+            Job job = std::move(jobSlots.Get(slot).payload);
+
+            jobSlots.Release(slot);
+
+            job();
+        }
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        JobSlotPool jobSlots;
+
+        std::mutex injectionMutex;
+        std::deque<uint32_t> injectionQueue;
+
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+
+        std::atomic<size_t> pendingJobs = 0;
+        std::atomic<size_t> sleepingWorkers = 0;
+        std::atomic<bool> stop = false;
+
+        static thread_local JobSystem* owner;
+        static thread_local size_t workerIndex;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<JobSystem> instance;
+
+    };
+
+    thread_local JobSystem* JobSystem::owner = nullptr;
+    thread_local size_t JobSystem::workerIndex = JobSystem::NO_WORKER;
+
+    std::once_flag JobSystem::initializationFlag;
+    std::unique_ptr<JobSystem> JobSystem::instance;
+}
\ No newline at end of file
@@ -1,13 +1,51 @@
 #pragma once
 
-#include <functional>
-#include <queue>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Thread/Job.hpp"
 
 namespace Wasteland::Thread
 {
+    enum class TaskPriority
+    {
+        HIGH,
+        NORMAL,
+        LOW
+    };
+
+    struct TaskHandle
+    {
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        uint32_t index = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        bool IsValid() const
+        {
+            return index != INVALID_INDEX;
+        }
+    };
+
+    struct MainThreadExecutorStatistics
+    {
+        std::array<size_t, 3> queueDepth = { };
+
+        size_t executedTasks = 0;
+        size_t carriedOverTasks = 0;
+
+        std::chrono::duration<float, std::milli> timeSpent = { };
+    };
+
     class MainThreadExecutor final
     {
-    
+
     public:
 
         MainThreadExecutor(const MainThreadExecutor&) = delete;
@@ -15,50 +53,156 @@ namespace Wasteland::Thread
         MainThreadExecutor& operator=(const MainThreadExecutor&) = delete;
         MainThreadExecutor& operator=(MainThreadExecutor&&) = delete;
 
-        void EnqueueTask(void* holder, std::function<void()> task)
+        TaskHandle EnqueueTask(Job task, TaskPriority priority = TaskPriority::NORMAL)
         {
             std::lock_guard<std::mutex> lock(mutex);
-            tasks.push(std::make_tuple(holder, std::move(task)));
+
+            TaskHandle handle = Allocate(std::move(task), priority);
+
+            queues[static_cast<size_t>(priority)].push_back({ handle.index, handle.generation, nextTicket++ });
+
+            return handle;
         }
 
-        void CancelTask(void* holder)
+        TaskHandle EnqueueNextFrameTask(Job task, TaskPriority priority = TaskPriority::NORMAL)
         {
             std::lock_guard<std::mutex> lock(mutex);
 
-            std::queue<std::tuple<void*, std::function<void()>>> newQueue;
+            TaskHandle handle = Allocate(std::move(task), priority);
 
-            while (!tasks.empty())
-            {
-                auto& front = tasks.front();
+            nextFrameTasks.push_back({ handle.index, handle.generation, 0 });
 
-                if (std::get<0>(front) != holder)
-                    newQueue.push(std::move(front));
+            return handle;
+        }
 
-                tasks.pop();
-            }
+        bool CancelTask(const TaskHandle& handle)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
 
-            tasks.swap(newQueue);
+            if (!handle.IsValid() || handle.index >= slots.size())
+                return false;
+
+            Slot& slot = slots[handle.index];
+
+            if (!slot.isQueued || slot.generation != handle.generation)
+                return false;
+
+            Release(handle.index);
+
+            return true;
         }
 
         void Execute()
         {
-            std::queue<std::tuple<void*, std::function<void()>>> localQueue;
+            auto start = std::chrono::steady_clock::now();
+
+            uint64_t ticketLimit;
+            std::chrono::microseconds budget;
 
             {
                 std::lock_guard<std::mutex> lock(mutex);
 
-                localQueue.swap(tasks);
+                ticketLimit = nextTicket;
+                budget = frameBudget;
+            }
+
+            size_t executed = 0;
+
+            while (true)
+            {
+                Job task;
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    if (!PopReady(ticketLimit, task))
+                        break;
+                }
+
+                task();
+
+                ++executed;
+
+                if (std::chrono::steady_clock::now() - start >= budget)
+                    break;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            size_t carriedOver = 0;
+
+            for (const auto& queue : queues)
+            {
+                for (const Entry& entry : queue)
+                {
+                    if (entry.ticket < ticketLimit && IsLive(entry))
+                        ++carriedOver;
+                }
             }
 
-            while (!localQueue.empty())
+            for (Entry entry : nextFrameTasks)
             {
-                auto& fn = localQueue.front();
+                if (!IsLive(entry))
+                    continue;
+
+                entry.ticket = nextTicket++;
+
+                queues[static_cast<size_t>(slots[entry.index].priority)].push_back(entry);
+            }
+
+            nextFrameTasks.clear();
 
-                if (std::get<0>(fn))
-                    std::get<1>(fn)();
+            statistics.queueDepth = liveTasks;
+            statistics.executedTasks = executed;
+            statistics.carriedOverTasks = carriedOver;
+            statistics.timeSpent = std::chrono::steady_clock::now() - start;
+        }
+
+        bool RunPendingTask()
+        {
+            Job task;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
 
-                localQueue.pop();
+                if (!PopReady(UINT64_MAX, task))
+                    return false;
             }
+
+            task();
+
+            return true;
+        }
+
+        void BindToCurrentThread()
+        {
+            mainThread.store(std::this_thread::get_id(), std::memory_order_release);
+        }
+
+        bool IsMainThread() const
+        {
+            return mainThread.load(std::memory_order_acquire) == std::this_thread::get_id();
+        }
+
+        void SetFrameBudget(std::chrono::microseconds budget)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            frameBudget = budget;
+        }
+
+        std::chrono::microseconds GetFrameBudget()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            return frameBudget;
+        }
+
+        MainThreadExecutorStatistics GetStatistics()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            return statistics;
         }
 
         static MainThreadExecutor& GetInstance()
@@ -73,10 +217,115 @@ namespace Wasteland::Thread
 
     private:
 
+        struct Slot
+        {
+            Job task;
+
+            uint32_t generation = 0;
+
+            TaskPriority priority = TaskPriority::NORMAL;
+
+            bool isQueued = false;
+        };
+
+        struct Entry
+        {
+            uint32_t index;
+            uint32_t generation;
+
+            uint64_t ticket;
+        };
+
         MainThreadExecutor() = default;
 
+        TaskHandle Allocate(Job task, TaskPriority priority)
+        {
+            uint32_t index;
+
+            if (!freeSlots.empty())
+            {
+                index = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                index = static_cast<uint32_t>(slots.size());
+                slots.emplace_back();
+            }
+
+            Slot& slot = slots[index];
+
+            slot.task = std::move(task);
+            slot.priority = priority;
+            slot.isQueued = true;
+
+            ++liveTasks[static_cast<size_t>(priority)];
+
+            return { index, slot.generation };
+        }
+
+        void Release(uint32_t index)
+        {
+            Slot& slot = slots[index];
+
+            slot.task.Reset();
+            slot.isQueued = false;
+
+            ++slot.generation;
+
+            --liveTasks[static_cast<size_t>(slot.priority)];
+
+            freeSlots.push_back(index);
+        }
+
+        bool IsLive(const Entry& entry) const
+        {
+            const Slot& slot = slots[entry.index];
+
+            return slot.isQueued && slot.generation == entry.generation;
+        }
+
+        bool PopReady(uint64_t ticketLimit, Job& task)
+        {
+            for (auto& queue : queues)
+            {
+                while (!queue.empty() && !IsLive(queue.front()))
+                    queue.pop_front();
+
+                if (queue.empty() || queue.front().ticket >= ticketLimit)
+                    continue;
+
+                uint32_t index = queue.front().index;
+
+                queue.pop_front();
+
+                task = std::move(slots[index].task);
+
+                Release(index);
+
+                return true;
+            }
+
+            return false;
+        }
+
         std::mutex mutex;
-        std::queue<std::tuple<void*, std::function<void()>>> tasks;
+
+        std::vector<Slot> slots;
+        std::vector<uint32_t> freeSlots;
+
+        std::array<std::deque<Entry>, 3> queues;
+        std::vector<Entry> nextFrameTasks;
+
+        std::array<size_t, 3> liveTasks = { };
+
+        uint64_t nextTicket = 0;
+
+        std::atomic<std::thread::id> mainThread = std::this_thread::get_id();
+
+        std::chrono::microseconds frameBudget = std::chrono::microseconds(4000);
+
+        MainThreadExecutorStatistics statistics;
 
         static std::once_flag initializationFlag;
         static std::unique_ptr<MainThreadExecutor> instance;
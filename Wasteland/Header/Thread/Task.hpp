@@ -0,0 +1,307 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "Thread/CoroutineFramePool.hpp"
+#include "Thread/JobSystem.hpp"
+#include "Thread/MainThreadExecutor.hpp"
+
+namespace Wasteland::Thread
+{
+    template <typename T = void>
+    class Task;
+
+    struct TaskFinalAwaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            Promise& promise = handle.promise();
+
+            std::coroutine_handle<> continuation = promise.continuation;
+
+            if (promise.detached)
+            {
+                handle.destroy();
+                return std::noop_coroutine();
+            }
+
+            promise.finished.store(true, std::memory_order_release);
+
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+    struct TaskPromiseBase
+    {
+        std::coroutine_handle<> continuation;
+
+        std::exception_ptr exception;
+
+        std::atomic<bool> finished = false;
+
+        bool detached = false;
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return { };
+        }
+
+        TaskFinalAwaiter final_suspend() noexcept
+        {
+            return { };
+        }
+
+        void unhandled_exception()
+        {
+            if (!detached)
+            {
+                exception = std::current_exception();
+                return;
+            }
+
+            MainThreadExecutor::GetInstance().EnqueueTask([exception = std::current_exception()]()
+            {
+                std::rethrow_exception(exception);
+            }, TaskPriority::HIGH);
+        }
+
+        static void* operator new(size_t size)
+        {
+            return CoroutineFramePool::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, size_t size)
+        {
+            CoroutineFramePool::Deallocate(pointer, size);
+        }
+    };
+
+    template <typename T>
+    struct TaskPromise : TaskPromiseBase
+    {
+        std::optional<T> value;
+
+        Task<T> get_return_object();
+
+        template <typename U>
+        void return_value(U&& result)
+        {
+            value.emplace(std::forward<U>(result));
+        }
+    };
+
+    template <>
+    struct TaskPromise<void> : TaskPromiseBase
+    {
+        Task<void> get_return_object();
+
+        void return_void() { }
+    };
+
+    template <typename T>
+    class Task final
+    {
+
+    public:
+
+        using promise_type = TaskPromise<T>;
+
+        Task() = default;
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) { }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                handle = std::exchange(other.handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        ~Task()
+        {
+            Reset();
+        }
+
+        auto operator co_await() && noexcept
+        {
+            struct Awaiter
+            {
+                std::coroutine_handle<promise_type> handle;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+                {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                auto await_resume()
+                {
+                    return TakeResult(handle);
+                }
+            };
+
+            return Awaiter{ handle };
+        }
+
+        void Start()
+        {
+            handle.resume();
+        }
+
+        void Detach() &&
+        {
+            auto detachedHandle = std::exchange(handle, nullptr);
+
+            detachedHandle.promise().detached = true;
+            detachedHandle.resume();
+        }
+
+        bool IsDone() const
+        {
+            return handle.promise().finished.load(std::memory_order_acquire);
+        }
+
+        auto GetResult()
+        {
+            return TakeResult(handle);
+        }
+
+    private:
+
+        explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) { }
+
+        static auto TakeResult(std::coroutine_handle<promise_type> handle)
+        {
+            if (handle.promise().exception)
+                std::rethrow_exception(handle.promise().exception);
+
+            if constexpr (!std::is_void_v<T>)
+                return std::move(*handle.promise().value);
+        }
+
+        void Reset()
+        {
+            if (handle)
+                std::exchange(handle, nullptr).destroy();
+        }
+
+        std::coroutine_handle<promise_type> handle;
+
+        friend struct TaskPromise<T>;
+
+    };
+
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object()
+    {
+        return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object()
+    {
+        return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+    }
+
+    inline auto ToWorker()
+    {
+        struct Awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                JobSystem::GetInstance().Submit([handle]() { handle.resume(); });
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        return Awaiter{ };
+    }
+
+    inline auto ToMainThread(TaskPriority priority = TaskPriority::NORMAL)
+    {
+        struct Awaiter
+        {
+            TaskPriority priority;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                MainThreadExecutor::GetInstance().EnqueueTask([handle]() { handle.resume(); }, priority);
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        return Awaiter{ priority };
+    }
+
+    inline auto NextFrame()
+    {
+        struct Awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                MainThreadExecutor::GetInstance().EnqueueNextFrameTask([handle]() { handle.resume(); });
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        return Awaiter{ };
+    }
+
+    template <typename T>
+    auto SyncWait(Task<T>& task)
+    {
+        task.Start();
+
+        while (!task.IsDone())
+        {
+            MainThreadExecutor::GetInstance().Execute();
+
+            if (!JobSystem::GetInstance().RunPendingJob())
+                std::this_thread::yield();
+        }
+
+        return task.GetResult();
+    }
+}
\ No newline at end of file
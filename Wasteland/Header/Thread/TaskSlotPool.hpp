@@ -0,0 +1,153 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace Wasteland::Thread
+{
+    template <typename Payload>
+    class TaskSlotPool final
+    {
+
+    public:
+
+        static constexpr uint32_t STATE_FREE = 0;
+        static constexpr uint32_t STATE_QUEUED = 1;
+        static constexpr uint32_t STATE_CANCELLED = 2;
+        static constexpr uint32_t STATE_RUNNING = 3;
+
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+        struct Slot
+        {
+            Payload payload;
+
+            std::atomic<uint64_t> stamp = 0;
+            std::atomic<uint32_t> nextFree = NO_SLOT;
+        };
+
+        TaskSlotPool() = default;
+
+        TaskSlotPool(const TaskSlotPool&) = delete;
+        TaskSlotPool(TaskSlotPool&&) = delete;
+        TaskSlotPool& operator=(const TaskSlotPool&) = delete;
+        TaskSlotPool& operator=(TaskSlotPool&&) = delete;
+
+        ~TaskSlotPool()
+        {
+            for (auto& segment : segments)
+                delete[] segment.load(std::memory_order_relaxed);
+        }
+
+        uint32_t Acquire()
+        {
+            while (true)
+            {
+                uint64_t head = freeHead.load(std::memory_order_acquire);
+
+                uint32_t index = static_cast<uint32_t>(head);
+
+                if (index == NO_SLOT)
+                {
+                    Grow();
+                    continue;
+                }
+
+                uint32_t next = Get(index).nextFree.load(std::memory_order_relaxed);
+
+                if (freeHead.compare_exchange_weak(head, MakeHead(head, next), std::memory_order_acq_rel, std::memory_order_relaxed))
+                    return index;
+            }
+        }
+
+        void Release(uint32_t index)
+        {
+            Slot& slot = Get(index);
+
+            slot.stamp.store(MakeStamp(GetGeneration(slot.stamp.load(std::memory_order_relaxed)) + 1, STATE_FREE), std::memory_order_release);
+
+            Push(index, index);
+        }
+
+        Slot& Get(uint32_t index)
+        {
+            return segments[index / SEGMENT_SIZE].load(std::memory_order_acquire)[index % SEGMENT_SIZE];
+        }
+
+        size_t GetCapacity() const
+        {
+            return segmentCount.load(std::memory_order_relaxed) * SEGMENT_SIZE;
+        }
+
+        static uint64_t MakeStamp(uint32_t generation, uint32_t state)
+        {
+            return (static_cast<uint64_t>(generation) << 32) | state;
+        }
+
+        static uint32_t GetGeneration(uint64_t stamp)
+        {
+            return static_cast<uint32_t>(stamp >> 32);
+        }
+
+        static uint32_t GetState(uint64_t stamp)
+        {
+            return static_cast<uint32_t>(stamp);
+        }
+
+    private:
+
+        static constexpr uint32_t SEGMENT_SIZE = 256;
+        static constexpr uint32_t MAXIMUM_SEGMENTS = 4096;
+
+        static uint64_t MakeHead(uint64_t previous, uint32_t index)
+        {
+            return ((previous >> 32) + 1) << 32 | index;
+        }
+
+        void Push(uint32_t first, uint32_t last)
+        {
+            uint64_t head = freeHead.load(std::memory_order_relaxed);
+
+            do
+            {
+                Get(last).nextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            }
+            while (!freeHead.compare_exchange_weak(head, MakeHead(head, first), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        void Grow()
+        {
+            std::lock_guard<std::mutex> lock(growMutex);
+
+            if (static_cast<uint32_t>(freeHead.load(std::memory_order_acquire)) != NO_SLOT)
+                return;
+
+            uint32_t segment = segmentCount.load(std::memory_order_relaxed);
+
+            if (segment >= MAXIMUM_SEGMENTS)
+                throw std::bad_alloc();
+
+            segments[segment].store(new Slot[SEGMENT_SIZE], std::memory_order_release);
+            segmentCount.store(segment + 1, std::memory_order_relaxed);
+
+            uint32_t first = segment * SEGMENT_SIZE;
+            uint32_t last = first + SEGMENT_SIZE - 1;
+
+            for (uint32_t i = first; i < last; ++i)
+                Get(i).nextFree.store(i + 1, std::memory_order_relaxed);
+
+            Push(first, last);
+        }
+
+        std::array<std::atomic<Slot*>, MAXIMUM_SEGMENTS> segments = { };
+        std::atomic<uint32_t> segmentCount = 0;
+
+        std::mutex growMutex;
+
+        std::atomic<uint64_t> freeHead = NO_SLOT;
+
+    };
+}
\ No newline at end of file
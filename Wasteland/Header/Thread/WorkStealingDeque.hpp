@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Wasteland::Thread
+{
+    template <typename T> requires std::is_trivially_copyable_v<T>
+    class WorkStealingDeque final
+    {
+
+    public:
+
+        explicit WorkStealingDeque(int64_t capacity = 1024)
+        {
+            buffer.store(new Buffer(capacity), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque(WorkStealingDeque&&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+        ~WorkStealingDeque()
+        {
+            delete buffer.load(std::memory_order_relaxed);
+        }
+
+        void Push(T item)
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_acquire);
+
+            Buffer* current = buffer.load(std::memory_order_relaxed);
+
+            if (b - t > current->capacity - 1)
+                current = Grow(current, t, b);
+
+            current->Put(b, item);
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        bool Pop(T& item)
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+
+            Buffer* current = buffer.load(std::memory_order_relaxed);
+
+            bottom.store(b, std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            int64_t t = top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            item = current->Get(b);
+
+            if (t == b)
+            {
+                bool isWon = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+                bottom.store(b + 1, std::memory_order_relaxed);
+
+                return isWon;
+            }
+
+            return true;
+        }
+
+        bool Steal(T& item)
+        {
+            int64_t t = top.load(std::memory_order_acquire);
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            int64_t b = bottom.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;
+
+            T stolen = buffer.load(std::memory_order_acquire)->Get(t);
+
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return false;
+
+            item = stolen;
+
+            return true;
+        }
+
+        bool IsEmpty() const
+        {
+            return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        struct Buffer
+        {
+            explicit Buffer(int64_t capacity) : capacity(capacity), mask(capacity - 1), items(new std::atomic<T>[capacity]) { }
+
+            void Put(int64_t index, T item)
+            {
+                items[index & mask].store(item, std::memory_order_relaxed);
+            }
+
+            T Get(int64_t index) const
+            {
+                return items[index & mask].load(std::memory_order_relaxed);
+            }
+
+            int64_t capacity;
+            int64_t mask;
+
+            std::unique_ptr<std::atomic<T>[]> items;
+        };
+
+        Buffer* Grow(Buffer* current, int64_t t, int64_t b)
+        {
+            Buffer* grown = new Buffer(current->capacity * 2);
+
+            for (int64_t i = t; i < b; ++i)
+                grown->Put(i, current->Get(i));
+
+            retired.emplace_back(current);
+
+            buffer.store(grown, std::memory_order_release);
+
+            return grown;
+        }
+
+        alignas(64) std::atomic<int64_t> top = 0;
+        alignas(64) std::atomic<int64_t> bottom = 0;
+
+        std::atomic<Buffer*> buffer;
+
+        std::vector<std::unique_ptr<Buffer>> retired;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Wasteland::Utility
+{
+    class AllocationCounter final
+    {
+
+    public:
+
+        AllocationCounter(const AllocationCounter&) = delete;
+        AllocationCounter(AllocationCounter&&) = delete;
+        AllocationCounter& operator=(const AllocationCounter&) = delete;
+        AllocationCounter& operator=(AllocationCounter&&) = delete;
+
+        static size_t GetAllocations()
+        {
+            return allocations.load(std::memory_order_relaxed);
+        }
+
+        static void* Allocate(size_t size)
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+
+            if (void* pointer = std::malloc(size == 0 ? 1 : size))
+                return pointer;
+
+            throw std::bad_alloc();
+        }
+
+        static void* AllocateAligned(size_t size, std::align_val_t alignment)
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+
+            size_t bytes = static_cast<size_t>(alignment);
+
+            size = (size + bytes - 1) / bytes * bytes;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+            void* pointer = _aligned_malloc(size == 0 ? bytes : size, bytes);
+#else
+            void* pointer = std::aligned_alloc(bytes, size == 0 ? bytes : size);
+#endif
+
+            if (!pointer)
+                throw std::bad_alloc();
+
+            return pointer;
+        }
+
+        static void Free(void* pointer)
+        {
+            std::free(pointer);
+        }
+
+        static void FreeAligned(void* pointer)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            _aligned_free(pointer);
+#else
+            std::free(pointer);
+#endif
+        }
+
+    private:
+
+        AllocationCounter() = default;
+
+        static std::atomic<size_t> allocations;
+
+    };
+}
\ No newline at end of file
@@ -1,15 +1,29 @@
 #pragma once
 
 #include <btBulletDynamicsCommon.h>
+#include "Collider/Colliders/ColliderMesh.hpp"
 #include "ECS/GameObject.hpp"
+#include "ECS/ObjectPool.hpp"
+#include "Math/BatchMath.hpp"
+#include "Math/Rigidbody.hpp"
 #include "Render/Mesh.hpp"
-#include "Thread/MainThreadExecutor.hpp"
+#include "Thread/JobHandle.hpp"
+#include "Utility/CoordinateHelper.hpp"
 
+using namespace Wasteland::Collider::Colliders;
 using namespace Wasteland::Render;
+using namespace Wasteland::Thread;
+using namespace Wasteland::Utility;
 
 namespace Wasteland::World
 {
-    class Chunk final : public Component, public std::enable_shared_from_this<Chunk>
+    struct ChunkGeometry
+    {
+        std::vector<Vertex> vertices;
+        std::vector<unsigned int> indices;
+    };
+
+    class Chunk final : public Component, public std::enable_shared_from_this<Chunk>, public Pooled<Chunk>
     {
 
     public:
@@ -19,7 +33,54 @@ namespace Wasteland::World
         Chunk& operator=(const Chunk&) = delete;
         Chunk& operator=(Chunk&&) = delete;
 
-        void Generate()
+        JobHandle<void> Generate()
+        {
+            auto weakSelf = std::weak_ptr<Chunk>(shared_from_this());
+
+            Vector<float, 3> chunkOffset = transform->GetWorldPosition();
+
+            int gridResolution = resolution;
+
+            auto geometry = JobGraph::Schedule([chunkOffset, gridResolution]()
+            {
+                return BuildGeometry(chunkOffset, gridResolution);
+            });
+
+            auto collider = geometry.Then([](const ChunkGeometry& result)
+            {
+                auto collider = ColliderMesh::Create(result.vertices, result.indices);
+
+                collider->Build();
+
+                return collider;
+            });
+
+            return JobGraph::WhenAll(geometry, collider).ThenOnMainThread([weakSelf, geometry, collider]()
+            {
+                auto self = weakSelf.lock();
+
+                if (!self || self->isDiscarded)
+                    return;
+
+                self->Upload(geometry.Get(), collider.Get());
+            }, TaskPriority::LOW);
+        }
+
+        void Discard()
+        {
+            isDiscarded = true;
+        }
+
+        static std::shared_ptr<Chunk> Create()
+        {
+            return MakePooledShared(new Chunk());
+        }
+
+    private:
+
+        Chunk() = default;
+
+        static ChunkGeometry BuildGeometry(const Vector<float, 3>& chunkOffset, int resolution)
         {
             const int gridVertices = resolution;
             const float totalSize = 32.0f;
@@ -29,13 +90,21 @@ namespace Wasteland::World
 
             const float baseFrequency = 0.1f;
 
-            Vector<float, 3> chunkOffset = GetGameObject()->GetTransform()->GetWorldPosition();
+            ChunkGeometry geometry;
 
-            vertices.clear();
-            indices.clear();
+            std::vector<Vertex>& vertices = geometry.vertices;
+            std::vector<unsigned int>& indices = geometry.indices;
 
             vertices.reserve(static_cast<size_t>(gridVertices) * gridVertices);
 
+            std::vector<float> normalXs;
+            std::vector<float> normalYs;
+            std::vector<float> normalZs;
+
+            normalXs.reserve(vertices.capacity());
+            normalYs.reserve(vertices.capacity());
+            normalZs.reserve(vertices.capacity());
+
             for (int j = 0; j < gridVertices; ++j)
             {
                 for (int i = 0; i < gridVertices; ++i)
@@ -72,26 +141,19 @@ namespace Wasteland::World
                     float heightU = SmoothNoise(chunkOffset.x() + x * freq,
                         chunkOffset.z() + (z + unitSize) * freq) * baseAmplitude;
 
-                    Vector<float, 3> normal;
-                    normal.x() = heightL - heightR;
-                    normal.y() = 2.0f;
-                    normal.z() = heightD - heightU;
-
-                    float length = std::sqrt(normal.x() * normal.x() + normal.y() * normal.y() + normal.z() * normal.z());
-
-                    if (length != 0.0f)
-                    {
-                        normal.x() /= length;
-                        normal.y() /= length;
-                        normal.z() /= length;
-                    }
-
-                    vertex.normal = normal;
+                    normalXs.push_back(heightL - heightR);
+                    normalYs.push_back(2.0f);
+                    normalZs.push_back(heightD - heightU);
 
                     vertices.push_back(vertex);
                 }
             }
 
+            BatchMath::NormalizeMany(normalXs, normalYs, normalZs);
+
+            for (size_t i = 0; i < vertices.size(); ++i)
+                vertices[i].normal = { normalXs[i], normalYs[i], normalZs[i] };
+
             for (int j = 0; j < gridVertices - 1; ++j)
             {
                 for (int i = 0; i < gridVertices - 1; ++i)
@@ -111,33 +173,22 @@ namespace Wasteland::World
                 }
             }
 
-            auto selfWeak = std::weak_ptr<Chunk>(shared_from_this());
-
-            MainThreadExecutor::GetInstance().EnqueueTask(this, [weakSelf = std::move(selfWeak)]()
-            {
-                auto self = weakSelf.lock();
-
-                if (!self)
-                    return;
-                    
-                auto mesh = self->GetGameObject()->GetComponent<Mesh>().value();
-
-                mesh->SetVertices(self->vertices);
-                mesh->SetIndices(self->indices);
-                mesh->Generate();
-            });
-
-            Super::GetGameObject()->AddComponent(ColliderMesh::Create(vertices, indices));
+            return geometry;
         }
 
-        static std::shared_ptr<Chunk> Create()
+        void Upload(const ChunkGeometry& geometry, const std::shared_ptr<ColliderMesh>& collider)
         {
-            return std::shared_ptr<Chunk>(new Chunk());
-        }
+            mesh->SetVertices(geometry.vertices);
+            mesh->SetIndices(geometry.indices);
+            mesh->Generate();
 
-    private:
+            GetGameObject()->AddComponent(collider);
+            GetGameObject()->AddComponent(Rigidbody<btBvhTriangleMeshShape>::Create(0.0f, true));
 
-        Chunk() = default;
+            Vector<int, 3> chunk = CoordinateHelper::WorldToChunkCoordinates(transform->GetWorldPosition());
+
+            PhysicsGlobal::GetInstance().MarkColumnResident({ chunk.x(), chunk.z() });
+        }
 
         static float Lerp(float a, float b, float t)
         {
@@ -180,7 +231,7 @@ namespace Wasteland::World
             return Lerp(i1, i2, v);
         }
 
-        float FractalNoise(float x, float z, int octaves, float persistence, float baseFrequency) 
+        static float FractalNoise(float x, float z, int octaves, float persistence, float baseFrequency) 
         {
             float total = 0.0f;
             float amplitude = 1.0f;
@@ -199,7 +250,9 @@ namespace Wasteland::World
 
         int resolution = 33;
 
-        std::vector<Vertex> vertices;
-        std::vector<unsigned int> indices;
+        bool isDiscarded = false;
+
+        Dependency<Mesh> mesh{ this };
+        Dependency<Transform> transform{ this };
     };
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include "Math/Rigidbody.hpp"
 #include "Render/ShaderManager.hpp"
 #include "Render/TextureManager.hpp"
-#include "Thread/ThreadPool.hpp"
+#include "Thread/JobSystem.hpp"
 #include "Utility/CoordinateHelper.hpp"
 #include "World/Chunk.hpp"
 
@@ -38,6 +38,7 @@ namespace Wasteland::World
     struct ChunkInfo
     {
         std::weak_ptr<Chunk> chunk;
+        EntityHandle entity;
         ChunkStatus status = ChunkStatus::ACTIVE;
     };
 
@@ -55,9 +56,7 @@ namespace Wasteland::World
         {
             std::unique_lock<std::mutex> lock(mapMutex);
 
-            auto it = chunkMap.find(pos);
-
-            if (it != chunkMap.end())
+            if (chunkMap.contains(pos) || generatingChunks.contains(pos))
                 return;
             
             {
@@ -84,8 +83,6 @@ namespace Wasteland::World
             {
                 std::unique_lock<std::mutex> pendingLock(pendingMutex);
 
-                MainThreadExecutor::GetInstance().CancelTask(it->second.chunk.lock().get());
-
                 pendingActions.push_back({ ActionType::REMOVE, pos });
             }
         }
@@ -109,12 +106,12 @@ namespace Wasteland::World
                         {
                             std::unique_lock<std::mutex> lock(mapMutex);
 
-                            alreadyExists = chunkMap.contains(chunkPos);
+                            alreadyExists = chunkMap.contains(chunkPos) || generatingChunks.contains(chunkPos);
                         }
 
                         if (!alreadyExists)
                         {
-                            threadPool.EnqueueTask([this, chunkPos]()
+                            JobSystem::GetInstance().Submit([this, chunkPos]()
                             {
                                 QueueAddChunk(chunkPos);
                             });
@@ -136,13 +133,22 @@ namespace Wasteland::World
 
             for (auto& pos : chunksToUnload)
             {
-                threadPool.EnqueueTask([this, pos]()
+                JobSystem::GetInstance().Submit([this, pos]()
                 {
                     QueueRemoveChunk(pos);
                 });
             }
 
             ApplyPendingActions();
+
+#if defined(WASTELAND_PROFILING)
+            ReportStreamingStatistics();
+#endif
+        }
+
+        static SystemAccess GetSystemAccess()
+        {
+            return SystemAccess().Write<PhysicsGlobal, Chunk>();
         }
 
         static std::shared_ptr<WorldBase> Create()
@@ -160,29 +166,38 @@ namespace Wasteland::World
 
         void GenerateChunkInternal(const Vector<int, 3>& position)
         {
-            auto chunkObject = GameObjectManager::GetInstance().Register(GameObject::Create(std::format("default.chunk_{}_{}_{}", position.x(), position.y(), position.z())));
+            {
+                std::unique_lock<std::mutex> lock(mapMutex);
 
-            chunkObject->GetTransform()->SetLocalPosition(CoordinateHelper::ChunkToWorldCoordinates(position));
-            chunkObject->AddComponent(ShaderManager::GetInstance().Get("default").value());
-            chunkObject->AddComponent(TextureManager::GetInstance().Get("grass").value());
-            chunkObject->AddComponent(Mesh::Create({}, {}));
-            chunkObject->AddComponent(Chunk::Create());
+                if (chunkMap.contains(position) || !generatingChunks.insert(position).second)
+                    return;
+            }
 
-            chunkObject->GetComponent<Chunk>().value()->Generate();
+            JobSystem::GetInstance().Submit([this, position]()
+            {
+                auto chunkObject = GameObject::Create();
 
-            chunkObject->AddComponent(Rigidbody<btBvhTriangleMeshShape>::Create(0.0f, true));
-            chunkObject->GetTransform()->SetLocalPosition(CoordinateHelper::ChunkToWorldCoordinates(position));
+                chunkObject->GetTransform()->SetLocalPosition(CoordinateHelper::ChunkToWorldCoordinates(position));
+                chunkObject->AddComponent(Mesh::Create({}, {}));
+
+                auto chunk = chunkObject->AddComponent(Chunk::Create());
+
+                GameObjectManager::GetInstance().Register(chunkObject);
+                GameObjectManager::GetInstance().AddComponent(chunkObject, ShaderManager::GetInstance().Get("default").value());
+                GameObjectManager::GetInstance().AddComponent(chunkObject, TextureManager::GetInstance().Get("grass").value());
+
+                chunk->Generate();
 
-            {
                 std::unique_lock<std::mutex> lock(mapMutex);
 
-                chunkMap.insert({ position, { chunkObject->GetComponent<Chunk>().value(), ChunkStatus::ACTIVE } });
-            }
+                generatingChunks.erase(position);
+                chunkMap.insert({ position, { chunk, chunkObject->GetHandle(), ChunkStatus::ACTIVE } });
+            });
         }
 
         void RemoveChunkInternal(const Vector<int, 3>& position)
         {
-            std::string objectName;
+            EntityHandle entity;
             {
                 std::unique_lock<std::mutex> lock(mapMutex);
 
@@ -191,13 +206,36 @@ namespace Wasteland::World
                 if (it == chunkMap.end())
                     return;
                 
-                objectName = it->second.chunk.lock()->GetGameObject()->GetName();
+                if (auto chunk = it->second.chunk.lock())
+                    chunk->Discard();
+
+                entity = it->second.entity;
 
                 chunkMap.erase(it);
             }
 
-            GameObjectManager::GetInstance().Unregister(objectName);
+            PhysicsGlobal::GetInstance().UnmarkColumnResident({ position.x(), position.z() });
+
+            GameObjectManager::GetInstance().Unregister(entity);
+        }
+
+#if defined(WASTELAND_PROFILING)
+        void ReportStreamingStatistics()
+        {
+            size_t residentChunks = PhysicsGlobal::GetInstance().GetResidentColumnCount();
+            size_t activeBodies = PhysicsGlobal::GetInstance().GetActiveBodyCount();
+            size_t parkedBodies = PhysicsGlobal::GetInstance().GetParkedBodyCount();
+
+            if (residentChunks == lastResidentChunks && activeBodies == lastActiveBodies && parkedBodies == lastParkedBodies)
+                return;
+
+            lastResidentChunks = residentChunks;
+            lastActiveBodies = activeBodies;
+            lastParkedBodies = parkedBodies;
+
+            std::cout << std::format("Streaming: {} resident chunks, {} active bodies, {} parked bodies", residentChunks, activeBodies, parkedBodies) << std::endl;
         }
+#endif
 
         void ApplyPendingActions()
         {
@@ -218,12 +256,17 @@ namespace Wasteland::World
 
         std::mutex mapMutex;
 
-        ThreadPool<3> threadPool;
-
         std::unordered_map<Vector<int, 3>, ChunkInfo> chunkMap;
+        std::unordered_set<Vector<int, 3>> generatingChunks;
 
         std::mutex pendingMutex;
         std::vector<PendingAction> pendingActions;
 
+#if defined(WASTELAND_PROFILING)
+        size_t lastResidentChunks = 0;
+        size_t lastActiveBodies = 0;
+        size_t lastParkedBodies = 0;
+#endif
+
     };
 }
\ No newline at end of file
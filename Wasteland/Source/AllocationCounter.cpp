@@ -0,0 +1,70 @@
+﻿#if defined(WASTELAND_PROFILING)
+
+#include "Utility/AllocationCounter.hpp"
+
+namespace Wasteland::Utility
+{
+	std::atomic<size_t> AllocationCounter::allocations = 0;
+}
+
+void* operator new(size_t size)
+{
+	return Wasteland::Utility::AllocationCounter::Allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+	return Wasteland::Utility::AllocationCounter::Allocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	return Wasteland::Utility::AllocationCounter::AllocateAligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+	return Wasteland::Utility::AllocationCounter::AllocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+	Wasteland::Utility::AllocationCounter::Free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+	Wasteland::Utility::AllocationCounter::Free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+	Wasteland::Utility::AllocationCounter::Free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+	Wasteland::Utility::AllocationCounter::Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+	Wasteland::Utility::AllocationCounter::FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+	Wasteland::Utility::AllocationCounter::FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept
+{
+	Wasteland::Utility::AllocationCounter::FreeAligned(pointer);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept
+{
+	Wasteland::Utility::AllocationCounter::FreeAligned(pointer);
+}
+
+#endif
\ No newline at end of file
@@ -2,10 +2,18 @@
 
 using namespace Wasteland;
 
-int main()
+int main(int argc, char** argv)
 {
 	try
 	{
+		for (int i = 1; i < argc; ++i)
+		{
+			if (std::string_view(argv[i]) == "--pipelined")
+				Application::GetInstance().SetFrameMode(FrameMode::PIPELINED);
+			else if (std::string_view(argv[i]) == "--sequential-systems")
+				SystemScheduler::GetInstance().SetExecutionMode(SystemExecutionMode::SEQUENTIAL);
+		}
+
 		Application::GetInstance().PreInitialize();
 		Application::GetInstance().Initialize();
 